@@ -0,0 +1,297 @@
+#ifndef __ASYNC_FOR_CFAP104212E00213_H__
+#define __ASYNC_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Non-blocking panel operations
+//
+// BUSY goes low while the controller works and back high when it is done.
+// That rising edge is caught by an external interrupt (D3 is INT1 on the
+// Uno), so a refresh can be started and left to run while the sketch does
+// something else.
+//
+// Work for the panel is queued as jobs. service() must be called regularly
+// from loop(): it notices the end of the current busy period, calls that
+// job's completion callback, and starts the next job once the controller is
+// idle. A job sends whatever it needs and, if that leaves the controller
+// busy, ends by calling startBusy() with the command that starts the work
+// (0x12 for a refresh).
+//
+// A partial refresh is started with partialRefresh() and also returns at
+// once; the queue takes the controller out of partial mode (0x92) when the
+// refresh ends. Code that starts new work on the panel outside of a job
+// calls waitReady() first, so that follow-up is never overtaken.
+//
+// service() also reads BUSY itself, so a missed edge does not stall the
+// queue. A busy period is over when BUSY is high after having been seen
+// low, when BUSY has not gone low at all EPD_BUSY_GRACE_MS after the
+// command, or, for a BUSY line stuck low, after EPD_BUSY_TIMEOUT_MS.
+// timedOut() tells the last case apart; the panel needs a reset after it.
+//=============================================================================
+#ifdef __AVR__
+#include <avr/sleep.h>
+#endif
+
+//Jobs that can be waiting at once
+#ifndef EPD_QUEUE_DEPTH
+#define EPD_QUEUE_DEPTH (4)
+#endif
+
+//BUSY goes low within microseconds of the command
+#ifndef EPD_BUSY_GRACE_MS
+#define EPD_BUSY_GRACE_MS (5)
+#endif
+//Longer than the slowest refresh: the tri-color waveform at 50 Hz
+#ifndef EPD_BUSY_TIMEOUT_MS
+#define EPD_BUSY_TIMEOUT_MS (40000UL)
+#endif
+
+//Sends its commands to the controller, context is passed through
+typedef void (*EPD_Job)(void *context);
+//Called once the controller is idle again after a job
+typedef void (*EPD_Callback)(void *context);
+
+template<class BUS>
+struct ePaperAsync
+{
+  //Attach the BUSY interrupt, call once after BUS::begin()
+  static void begin(void)
+  {
+    int irq = digitalPinToInterrupt(BUS::busy_pin);
+    use_irq = (0 <= irq);
+    if (use_irq)
+    {
+      attachInterrupt(irq, onReady, RISING);
+    }
+  }
+
+  //Issue a command that makes the controller busy, without waiting for it
+  static void startBusy(uint8_t command)
+  {
+    done = false;
+    seen_busy = false;
+    busy = true;
+    timed_out = false;
+    busy_since = millis();
+#if EPD_TIMING
+    busy_command = command;
+    busy_start = micros();
+#endif
+    BUS::writeCMD(command);
+  }
+
+  //Start a full refresh and return immediately
+  static inline void refresh(void) { startBusy(0x12); }
+
+  //Refresh the partial window set with 0x90 and return immediately, the
+  //controller is in partial mode (0x91). Partial Out (0x92) is sent when
+  //the refresh is done.
+  static void partialRefresh(void)
+  {
+    startBusy(0x12);
+    partial = true;
+  }
+
+  //Wait for the busy period in progress to end and what follows it to be
+  //sent, then for BUSY. Unlike waitIdle() no queued job is started, so a
+  //job may call it too.
+  static void waitReady(void)
+  {
+    while (busy && !endBusy())
+    {
+    }
+    BUS::waitReady();
+  }
+
+  //True if the last busy period was given up on with BUSY still low
+  static inline bool timedOut(void) { return timed_out; }
+
+  //True when nothing is running or queued
+  static bool idle(void)
+  {
+    service();
+    return !busy && (count == 0);
+  }
+
+  //Queue job to run once the controller is free. done (optional) is called
+  //from service() when the controller is idle again afterwards. Returns
+  //false if the queue is full.
+  static bool submit(EPD_Job job, void *context, EPD_Callback done_callback = 0)
+  {
+    if (count == EPD_QUEUE_DEPTH)
+    {
+      return false;
+    }
+    uint8_t slot = (head + count) % EPD_QUEUE_DEPTH;
+    queue[slot].job = job;
+    queue[slot].done = done_callback;
+    queue[slot].context = context;
+    count++;
+    service();
+    return true;
+  }
+
+  //Advance the queue, call as often as possible
+  static void service(void)
+  {
+    if (busy && !endBusy())
+    {
+      return;
+    }
+    while (!busy && (count != 0))
+    {
+      Entry entry = queue[head];
+      head = (head + 1) % EPD_QUEUE_DEPTH;
+      count--;
+      entry.job(entry.context);
+      if (busy)
+      {
+        current_done = entry.done;
+        current_context = entry.context;
+      }
+      else if (entry.done)
+      {
+        entry.done(entry.context);
+      }
+    }
+  }
+
+  //Run the queue dry, idling the CPU between interrupts
+  static void waitIdle(void)
+  {
+    while (!idle())
+    {
+#ifdef __AVR__
+      if (use_irq)
+      {
+        //the BUSY edge or the millis() tick wakes us
+        set_sleep_mode(SLEEP_MODE_IDLE);
+        sleep_mode();
+      }
+#endif
+    }
+  }
+
+private:
+  struct Entry
+  {
+    EPD_Job      job;
+    EPD_Callback done;
+    void        *context;
+  };
+
+  //Finish the busy period in progress if it has ended: leave partial mode
+  //and call the job's callback. False while it goes on.
+  static bool endBusy(void)
+  {
+    if (!done)
+    {
+      //the end of the busy period, for a pin without an interrupt or an
+      //edge the interrupt missed
+      uint32_t elapsed = millis() - busy_since;
+      if (BUS::busy())
+      {
+        seen_busy = true;
+        if (EPD_BUSY_TIMEOUT_MS <= elapsed)
+        {
+          timed_out = true;
+          onReady();
+        }
+      }
+      else if (seen_busy || (EPD_BUSY_GRACE_MS <= elapsed))
+      {
+        onReady();
+      }
+    }
+    if (!done)
+    {
+      return false;
+    }
+    busy = false;
+#if EPD_TIMING
+    recordBusy();
+#endif
+    if (partial)
+    {
+      //turn off partial update mode
+      partial = false;
+      BUS::writeCMD(0x92);
+    }
+    if (current_done)
+    {
+      EPD_Callback callback = current_done;
+      current_done = 0;
+      callback(current_context);
+    }
+    return true;
+  }
+
+  static void onReady(void)
+  {
+#if EPD_TIMING
+    busy_end = micros();
+#endif
+    done = true;
+  }
+
+#if EPD_TIMING
+  //Log the busy period that just ended, timed to the BUSY edge
+  static void recordBusy(void)
+  {
+    uint8_t phase = TIMING_BUSY;
+    uint8_t detail = busy_command;
+    if (busy_command == 0x04)
+    {
+      phase = TIMING_POWER_ON;
+    }
+    else if (busy_command == 0x12)
+    {
+      phase = TIMING_REFRESH;
+      detail = partial;
+    }
+    timingRecord(phase, detail, busy_start, busy_end);
+  }
+
+  static uint8_t busy_command;
+  static uint32_t busy_start;
+  static volatile uint32_t busy_end;
+#endif
+
+  static volatile bool done;
+  static bool seen_busy;
+  static bool busy;
+  static bool partial;
+  static bool timed_out;
+  static uint32_t busy_since;
+  static bool use_irq;
+  static Entry queue[EPD_QUEUE_DEPTH];
+  static uint8_t head;
+  static uint8_t count;
+  static EPD_Callback current_done;
+  static void *current_context;
+};
+
+template<class BUS> volatile bool ePaperAsync<BUS>::done = false;
+template<class BUS> bool ePaperAsync<BUS>::seen_busy = false;
+template<class BUS> bool ePaperAsync<BUS>::busy = false;
+template<class BUS> bool ePaperAsync<BUS>::partial = false;
+template<class BUS> bool ePaperAsync<BUS>::timed_out = false;
+template<class BUS> uint32_t ePaperAsync<BUS>::busy_since = 0;
+template<class BUS> bool ePaperAsync<BUS>::use_irq = false;
+template<class BUS> typename ePaperAsync<BUS>::Entry ePaperAsync<BUS>::queue[EPD_QUEUE_DEPTH];
+template<class BUS> uint8_t ePaperAsync<BUS>::head = 0;
+template<class BUS> uint8_t ePaperAsync<BUS>::count = 0;
+template<class BUS> EPD_Callback ePaperAsync<BUS>::current_done = 0;
+template<class BUS> void *ePaperAsync<BUS>::current_context = 0;
+#if EPD_TIMING
+template<class BUS> uint8_t ePaperAsync<BUS>::busy_command = 0;
+template<class BUS> uint32_t ePaperAsync<BUS>::busy_start = 0;
+template<class BUS> volatile uint32_t ePaperAsync<BUS>::busy_end = 0;
+#endif
+
+//=============================================================================
+#endif
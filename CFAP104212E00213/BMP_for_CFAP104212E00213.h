@@ -0,0 +1,254 @@
+#ifndef __BMP_FOR_CFAP104212E00213_H__
+#define __BMP_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Streaming BMP decoder
+//
+// The file is read front to back exactly once. Each row is converted into
+// both planes as it arrives and collected in the shared band buffer; every
+// EPD_BAND_ROWS rows the band is written to the controller through a
+// partial window (see writeOrientedBand()). Bottom-up and top-down files
+// both work since a band is addressed by its rows, not by the order they
+// were read.
+//
+// Supported: uncompressed (BI_RGB) 1, 8 and 24 bits per pixel, any of the
+// BITMAPINFOHEADER family, exactly panel sized for the orientation: 104 x
+// 212 upright or 212 x 104 rotated.
+//=============================================================================
+#include <SD.h>
+
+//Pixels of a 24 bit row read and converted at a time (a multiple of 8)
+#define BMP_CHUNK_PIXELS (EPD_HRES)
+
+//Row buffer: a chunk of 24 bit pixels plus a row's padding, which also
+//holds a whole 1 or 8 bit row at either orientation
+#define BMP_LINE_BYTES (BMP_CHUNK_PIXELS * 3 + 3)
+
+struct BMP_Info
+{
+  uint32_t data_offset;
+  uint16_t width;
+  uint16_t height;
+  uint8_t  top_down;
+  uint8_t  bpp;
+  uint16_t stride;
+  //Palette entries as 2-bit classes, see setPaletteClass()
+  uint8_t  classes[64];
+};
+
+static inline uint16_t bmpRead16(const uint8_t *p)
+{
+  return p[0] | ((uint16_t)p[1] << 8);
+}
+
+static inline uint32_t bmpRead32(const uint8_t *p)
+{
+  return bmpRead16(p) | ((uint32_t)bmpRead16(p + 2) << 16);
+}
+
+//Parse the file and info headers and the palette, leaving the file at the
+//first pixel. The image must be width x height. buffer needs at least 54
+//bytes.
+bool readBMPHeader(File &file, BMP_Info &info, uint8_t *buffer,
+                   uint16_t width_pixels, uint16_t height_pixels)
+{
+  if (54 != file.read(buffer, 54))
+  {
+    return false;
+  }
+  if ((buffer[0] != 'B') || (buffer[1] != 'M'))
+  {
+    return false;
+  }
+  info.data_offset = bmpRead32(&buffer[10]);
+  uint32_t header_size = bmpRead32(&buffer[14]);
+  int32_t width = (int32_t)bmpRead32(&buffer[18]);
+  int32_t height = (int32_t)bmpRead32(&buffer[22]);
+  info.bpp = bmpRead16(&buffer[28]);
+  uint32_t compression = bmpRead32(&buffer[30]);
+  uint32_t colors = bmpRead32(&buffer[46]);
+
+  if ((header_size < 40) || (compression != 0))
+  {
+    return false;
+  }
+  if ((info.bpp != 1) && (info.bpp != 8) && (info.bpp != 24))
+  {
+    return false;
+  }
+  //negative height means the rows are stored top row first
+  info.top_down = (height < 0);
+  if (height < 0)
+  {
+    height = -height;
+  }
+  if ((width != width_pixels) || (height != height_pixels))
+  {
+    return false;
+  }
+  info.width = width;
+  info.height = height;
+  //rows are padded to a multiple of 4 bytes
+  info.stride = ((info.width * info.bpp + 31) / 32) * 4;
+
+  //skip the rest of a V4/V5 header
+  uint32_t position = 14 + header_size;
+  if (!file.seek(position))
+  {
+    return false;
+  }
+
+  if (info.bpp <= 8)
+  {
+    if ((colors == 0) || ((1UL << info.bpp) < colors))
+    {
+      colors = 1UL << info.bpp;
+    }
+    memset(info.classes, 0, sizeof(info.classes));
+    for (uint16_t i = 0; i < colors; i++)
+    {
+      //B, G, R, reserved
+      if (4 != file.read(buffer, 4))
+      {
+        return false;
+      }
+      setPaletteClass(info.classes, i, buffer[2], buffer[1], buffer[0]);
+    }
+    position += colors * 4;
+  }
+
+  //pixel data normally follows directly, but the offset is authoritative
+  if (info.data_offset < position)
+  {
+    return false;
+  }
+  if (info.data_offset != position)
+  {
+    return file.seek(info.data_offset);
+  }
+  return true;
+}
+
+//Read the next file row through line and decode it into bw/yellow
+static bool readBMPRow(File &file, const BMP_Info &info, uint8_t *line,
+                       uint8_t *bw, uint8_t *yellow)
+{
+  if (info.bpp != 24)
+  {
+    if (info.stride != file.read(line, info.stride))
+    {
+      return false;
+    }
+    convertPixels_Indexed(line, info.width, info.bpp, info.classes, bw, yellow);
+    return true;
+  }
+  //a chunk at a time, the last one picks up the row's padding
+  uint16_t left = info.stride;
+  for (uint16_t x = 0; x < info.width; x += BMP_CHUNK_PIXELS)
+  {
+    uint16_t pixels = info.width - x;
+    uint16_t bytes = left;
+    if (BMP_CHUNK_PIXELS < pixels)
+    {
+      pixels = BMP_CHUNK_PIXELS;
+      bytes = pixels * 3;
+    }
+    if (bytes != file.read(line, bytes))
+    {
+      return false;
+    }
+    left -= bytes;
+    //convert in place, then move the planes out
+    uint8_t n = (pixels + 7) / 8;
+    convertPixels_BGR(line, pixels, line, line + n, x);
+    memcpy(bw + (x >> 3), line, n);
+    memcpy(yellow + (x >> 3), line + n, n);
+  }
+  return true;
+}
+
+//Read a whole BMP from file and load both planes into the controller's RAM.
+//The panel is not refreshed. Returns false if the file is not usable; the
+//controller may then hold part of the image.
+//
+//The file must be orientWidth() x orientHeight() for orientation (see
+//Orient_for_CFAP104212E00213.h).
+//
+//If planes is given, the converted planes are also written to it as they
+//go, in file orientation: BW at planes_offset and yellow one plane
+//(orientRowBytes() * orientHeight()) later. That part of planes must
+//already exist since bottom-up files are written last row first. If a seek
+//or write to planes fails, planes is closed and the image still loads.
+template<class BUS>
+bool loadBMP(File &file, uint8_t orientation = ROTATE_0,
+             File *planes = 0, uint32_t planes_offset = 0)
+{
+  static uint8_t line[BMP_LINE_BYTES];
+  static BMP_Info info;
+
+  if (!readBMPHeader(file, info, line, orientWidth(orientation), orientHeight(orientation)))
+  {
+    return false;
+  }
+  if ((info.bpp != 24) && (BMP_LINE_BYTES < info.stride))
+  {
+    return false;
+  }
+  uint8_t row_bytes = orientRowBytes(orientation);
+  uint16_t plane_bytes = (uint16_t)row_bytes * info.height;
+  //no dither error carried over from the last image
+  ditherBegin(dither_mode);
+
+  bool ok = true;
+  beginBands<BUS>();
+  for (uint16_t band_start = 0; band_start < info.height; band_start += EPD_BAND_ROWS)
+  {
+    uint8_t rows = EPD_BAND_ROWS;
+    if (info.height - band_start < rows)
+    {
+      rows = info.height - band_start;
+    }
+    //file rows come in panel order for top-down files, reversed otherwise
+    {
+      EPD_TIMED(TIMING_SD, rows);
+      for (uint8_t r = 0; r < rows; r++)
+      {
+        uint16_t slot = (info.top_down ? r : (rows - 1 - r)) * row_bytes;
+        if (!readBMPRow(file, info, line, &epd_band_bw[slot], &epd_band_yellow[slot]))
+        {
+          ok = false;
+          break;
+        }
+      }
+    }
+    if (!ok)
+    {
+      break;
+    }
+    uint16_t y = info.top_down ? band_start : (info.height - band_start - rows);
+    writeOrientedBand<BUS>(orientation, y, rows, epd_band_bw, epd_band_yellow);
+    if (planes)
+    {
+      uint16_t band_bytes = (uint16_t)rows * row_bytes;
+      uint32_t at = planes_offset + (uint32_t)y * row_bytes;
+      if (!(planes->seek(at) &&
+            (band_bytes == planes->write(epd_band_bw, band_bytes)) &&
+            planes->seek(at + plane_bytes) &&
+            (band_bytes == planes->write(epd_band_yellow, band_bytes))))
+      {
+        planes->close();
+        planes = 0;
+      }
+    }
+  }
+  endBands<BUS>();
+  return ok;
+}
+
+//=============================================================================
+#endif
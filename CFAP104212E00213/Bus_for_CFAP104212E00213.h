@@ -0,0 +1,413 @@
+#ifndef __BUS_FOR_CFAP104212E00213_H__
+#define __BUS_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Pin and SPI bus layer
+//
+// Pin numbers are template parameters, so on the ATmega328P each pin resolves
+// at compile time to a single sbi/cbi/sbic on its port register instead of
+// the digitalWrite()/digitalRead() table lookups. Other targets fall back to
+// digitalWrite()/digitalRead().
+//
+// A panel's wiring is described once:
+//
+//   typedef ePaperBus<EPD_CS, EPD_DC, EPD_RESET, EPD_READY> EPD;
+//
+// and everything that talks to the controller goes through EPD::. A second
+// panel or board is just another typedef.
+//
+// The panel shares the SPI bus with the SD card. Every chip select
+// assertion is bracketed by SPI.beginTransaction()/endTransaction() with
+// the panel's own SPISettings (the SD library does the same with its own),
+// so each device gets its own clock and the two are never selected at once.
+// Every chip select on the bus must be high before SPI.begin().
+//
+// On AVR, data is written straight to SPDR: the next byte is fetched from
+// RAM or flash while the current one is shifting out, and nothing is read
+// back.
+//=============================================================================
+#include <SPI.h>
+
+//Set to 1 to count bytes and chip select assertions sent to the controller
+#ifndef EPD_BUS_STATS
+#define EPD_BUS_STATS (0)
+#endif
+
+//EPD_SPI_TRACE(dc, data, n) can be defined before this header is included
+//to see every byte sent to the controller, dc is 0 for the command byte and
+//1 for data. A host build uses it to feed a model of the controller.
+#ifndef EPD_SPI_TRACE
+#define EPD_SPI_TRACE(dc, data, n)
+#endif
+
+//Panel geometry in pixels, and bytes in one row and in the whole of one plane
+#define EPD_HRES        (104)
+#define EPD_VRES        (212)
+#define EPD_ROW_BYTES   (EPD_HRES / 8)
+#define EPD_PLANE_BYTES (EPD_ROW_BYTES * EPD_VRES)
+
+//Pixel colours: black is 1 in the BW plane (0x10), yellow is 1 in the
+//yellow plane (0x13), white is 0 in both
+#define EPD_WHITE  (0)
+#define EPD_BLACK  (1)
+#define EPD_YELLOW (2)
+
+//Panel SPI clock. The controller takes writes with a 100 ns clock cycle,
+//10 MHz; SPISettings rounds down to what the board can do (8 MHz on a 16
+//MHz Uno). Reads are clocked by hand, see readData(). Lower it for long
+//wires.
+#ifndef EPD_SPI_HZ
+#define EPD_SPI_HZ (10000000UL)
+#endif
+
+//Write-only SPDR loops, AVR only
+#if defined(__AVR__) && !defined(EPD_SPI_DIRECT)
+#define EPD_SPI_DIRECT (1)
+#endif
+#ifndef EPD_SPI_DIRECT
+#define EPD_SPI_DIRECT (0)
+#endif
+
+//Bytes staged in RAM per SPI.transfer(buffer, count) call when the source
+//is const or in flash (SPI.transfer() overwrites the buffer it is given).
+//Only used without EPD_SPI_DIRECT.
+#ifndef EPD_CHUNK
+#define EPD_CHUNK (16)
+#endif
+
+//=============================================================================
+#if defined(__AVR_ATmega328P__) || defined(__AVR_ATmega168__) || defined(__AVR_ATmega328__)
+//Uno / Seeeduino pin map: D0-D7 on PORTD, D8-D13 on PORTB, A0-A5 on PORTC
+template<uint8_t PIN>
+struct FastPin
+{
+  static volatile uint8_t &port(void) { return (PIN < 8) ? PORTD : (PIN < 14) ? PORTB : PORTC; }
+  static volatile uint8_t &ddr(void)  { return (PIN < 8) ? DDRD  : (PIN < 14) ? DDRB  : DDRC; }
+  static volatile uint8_t &in(void)   { return (PIN < 8) ? PIND  : (PIN < 14) ? PINB  : PINC; }
+  static const uint8_t mask = 1 << ((PIN < 8) ? PIN : (PIN < 14) ? (PIN - 8) : (PIN - 14));
+
+  static inline void output(void) { ddr() |= mask; }
+  static inline void input(void)  { ddr() &= ~mask; }
+  static inline void high(void)   { port() |= mask; }
+  static inline void low(void)    { port() &= ~mask; }
+  static inline uint8_t read(void) { return (in() & mask) ? 1 : 0; }
+};
+#else
+//Other targets, including host builds. EPD_PIN_TRACE(pin, level) can be
+//defined before this header is included to record every pin transition.
+#ifndef EPD_PIN_TRACE
+#define EPD_PIN_TRACE(pin, level)
+#endif
+template<uint8_t PIN>
+struct FastPin
+{
+  static inline void output(void) { pinMode(PIN, OUTPUT); }
+  static inline void input(void)  { pinMode(PIN, INPUT); }
+  static inline void high(void)   { EPD_PIN_TRACE(PIN, HIGH); digitalWrite(PIN, HIGH); }
+  static inline void low(void)    { EPD_PIN_TRACE(PIN, LOW); digitalWrite(PIN, LOW); }
+  static inline uint8_t read(void) { return digitalRead(PIN) ? 1 : 0; }
+};
+#endif
+
+//=============================================================================
+// A command byte followed by any number of data bytes is sent under a single
+// chip select assertion. beginCMD() selects the controller, sends the command
+// and leaves DC aimed at the data register; the stream*() functions can then
+// be called as many times as needed before endTransfer() releases the
+// controller. beginData() reselects the controller to continue the data of
+// the last command, so the bus can be handed to the SD card in between.
+template<uint8_t CS_PIN, uint8_t DC_PIN, uint8_t RESET_PIN, uint8_t BUSY_PIN,
+         uint32_t SPI_HZ = EPD_SPI_HZ>
+struct ePaperBus
+{
+  typedef FastPin<CS_PIN>    CS;
+  typedef FastPin<DC_PIN>    DC;
+  typedef FastPin<RESET_PIN> RST;
+  typedef FastPin<BUSY_PIN>  BUSY;
+
+  static const uint8_t cs_pin = CS_PIN;
+  static const uint8_t dc_pin = DC_PIN;
+  static const uint8_t reset_pin = RESET_PIN;
+  static const uint8_t busy_pin = BUSY_PIN;
+
+#if EPD_BUS_STATS
+  static uint32_t bytes;
+  static uint32_t cs_assertions;
+#endif
+
+  //Configure the pin directions, controller deselected. Call before
+  //SPI.begin().
+  static void begin(void)
+  {
+    CS::high();
+    CS::output();
+    DC::output();
+    RST::high();
+    RST::output();
+    BUSY::input();
+  }
+
+  //BUSY is low while the controller is working
+  static inline bool busy(void) { return 0 == BUSY::read(); }
+  static inline void waitReady(void) { while (busy()); }
+
+  //this function will take in a byte and send it to the display with the
+  //command bit low for command transmission
+  static void writeCMD(uint8_t command)
+  {
+    DC::low();
+    select();
+    EPD_SPI_TRACE(0, &command, 1);
+    SPI.transfer(command);
+    count(1);
+    deselect();
+  }
+
+  //this function will take in a byte and send it to the display with the
+  //command bit high for data transmission
+  static void writeData(uint8_t data)
+  {
+    DC::high();
+    select();
+    EPD_SPI_TRACE(1, &data, 1);
+    SPI.transfer(data);
+    count(1);
+    deselect();
+  }
+
+  static void beginCMD(uint8_t command)
+  {
+    DC::low();
+    select();
+    EPD_SPI_TRACE(0, &command, 1);
+    SPI.transfer(command);
+    count(1);
+    DC::high();
+  }
+
+  static void beginData(void)
+  {
+    DC::high();
+    select();
+  }
+
+  static inline void endTransfer(void)
+  {
+    deselect();
+  }
+
+  //Send a RAM buffer. The buffer may be overwritten with whatever was
+  //clocked in.
+  static void streamBuffer(uint8_t *data, uint16_t n)
+  {
+#if EPD_SPI_DIRECT
+    streamData(data, n);
+#else
+    EPD_SPI_TRACE(1, data, n);
+    SPI.transfer(data, n);
+    count(n);
+#endif
+  }
+
+  //Send bytes from RAM without disturbing them
+  static void streamData(const uint8_t *data, uint16_t n)
+  {
+#if EPD_SPI_DIRECT
+    EPD_SPI_TRACE(1, data, n);
+    count(n);
+    if (n == 0)
+    {
+      return;
+    }
+    SPDR = *data++;
+    while (--n != 0)
+    {
+      uint8_t next = *data++;
+      spiWait();
+      SPDR = next;
+    }
+    spiWait();
+#else
+    uint8_t chunk[EPD_CHUNK];
+    while (n != 0)
+    {
+      uint8_t c = (EPD_CHUNK < n) ? EPD_CHUNK : n;
+      memcpy(chunk, data, c);
+      streamBuffer(chunk, c);
+      data += c;
+      n -= c;
+    }
+#endif
+  }
+
+  //Send bytes from PROGMEM
+  static void streamData_Flash(const uint8_t *data, uint16_t n)
+  {
+#if EPD_SPI_DIRECT
+    count(n);
+    if (n == 0)
+    {
+      return;
+    }
+    SPDR = pgm_read_byte(data++);
+    while (--n != 0)
+    {
+      uint8_t next = pgm_read_byte(data++);
+      spiWait();
+      SPDR = next;
+    }
+    spiWait();
+#else
+    uint8_t chunk[EPD_CHUNK];
+    while (n != 0)
+    {
+      uint8_t c = (EPD_CHUNK < n) ? EPD_CHUNK : n;
+      memcpy_P(chunk, data, c);
+      streamBuffer(chunk, c);
+      data += c;
+      n -= c;
+    }
+#endif
+  }
+
+  //Send the same byte n times
+  static void streamFill(uint8_t value, uint16_t n)
+  {
+#if EPD_SPI_DIRECT
+    count(n);
+    while (n != 0)
+    {
+      SPDR = value;
+      n--;
+      spiWait();
+    }
+#else
+    uint8_t chunk[EPD_CHUNK];
+    while (n != 0)
+    {
+      uint8_t c = (EPD_CHUNK < n) ? EPD_CHUNK : n;
+      memset(chunk, value, c);
+      streamBuffer(chunk, c);
+      n -= c;
+    }
+#endif
+  }
+
+  //One command and its parameters from RAM, one chip select
+  static void writeCMDData(uint8_t command, const uint8_t *data, uint16_t n)
+  {
+    beginCMD(command);
+    streamData(data, n);
+    endTransfer();
+  }
+
+  //One command and its parameters from PROGMEM, one chip select
+  static void writeCMDData_Flash(uint8_t command, const uint8_t *data, uint16_t n)
+  {
+    beginCMD(command);
+    streamData_Flash(data, n);
+    endTransfer();
+  }
+
+  //One command followed by n copies of value, one chip select
+  static void writeCMDFill(uint8_t command, uint8_t value, uint16_t n)
+  {
+    beginCMD(command);
+    streamFill(value, n);
+    endTransfer();
+  }
+
+  //Read n bytes back after a command such as TSC (0x40). The panel has one
+  //bidirectional data line on MOSI, so the SPI peripheral is released and
+  //the bits are clocked in by hand (mode 0, sampled after the rising edge).
+  //The transaction keeps the bus for the panel meanwhile.
+  //
+  //On the AVR only SPE is cleared, which hands MOSI and SCK back to their
+  //port bits, and the saved SPCR is put back afterwards. SPI.end() and
+  //SPI.begin() would also redo the pin setup and reset the clock settings
+  //of the transaction in progress.
+  static void readData(uint8_t *data, uint8_t n)
+  {
+    typedef FastPin<MOSI> SDA;
+    typedef FastPin<SCK>  SCL;
+    DC::high();
+    select();
+#ifdef __AVR__
+    uint8_t spcr = SPCR;
+    SPCR = spcr & ~_BV(SPE);
+#else
+    SPI.end();
+#endif
+    SDA::input();
+    while (n != 0)
+    {
+      uint8_t value = 0;
+      for (uint8_t bit = 0; bit < 8; bit++)
+      {
+        SCL::high();
+        delayMicroseconds(1);
+        value = (value << 1) | SDA::read();
+        SCL::low();
+        delayMicroseconds(1);
+      }
+      *data++ = value;
+      n--;
+    }
+    SDA::output();
+#ifdef __AVR__
+    SPCR = spcr;
+#else
+    SPI.begin();
+#endif
+    deselect();
+  }
+
+private:
+  //Take the bus at the panel's clock, then select the panel
+  static inline void select(void)
+  {
+    SPI.beginTransaction(SPISettings(SPI_HZ, MSBFIRST, SPI_MODE0));
+    CS::low();
+#if EPD_BUS_STATS
+    cs_assertions++;
+#endif
+  }
+
+  //Release the panel, then the bus
+  static inline void deselect(void)
+  {
+    CS::high();
+    SPI.endTransaction();
+  }
+
+#if EPD_SPI_DIRECT
+  static inline void spiWait(void)
+  {
+    while (!(SPSR & _BV(SPIF)));
+  }
+#endif
+
+  static inline void count(uint16_t n)
+  {
+#if EPD_BUS_STATS
+    bytes += n;
+#else
+    (void)n;
+#endif
+  }
+};
+
+#if EPD_BUS_STATS
+template<uint8_t CS_PIN, uint8_t DC_PIN, uint8_t RESET_PIN, uint8_t BUSY_PIN, uint32_t SPI_HZ>
+uint32_t ePaperBus<CS_PIN, DC_PIN, RESET_PIN, BUSY_PIN, SPI_HZ>::bytes = 0;
+template<uint8_t CS_PIN, uint8_t DC_PIN, uint8_t RESET_PIN, uint8_t BUSY_PIN, uint32_t SPI_HZ>
+uint32_t ePaperBus<CS_PIN, DC_PIN, RESET_PIN, BUSY_PIN, SPI_HZ>::cs_assertions = 0;
+#endif
+
+//=============================================================================
+#endif
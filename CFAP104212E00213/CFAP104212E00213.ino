@@ -66,6 +66,17 @@
 // Bmp_to_epaper is code that will aid in creating bitmaps necessary from .bmp files.
 // The code can be downloaded from the Crystalfontz website: https://www.Crystalfontz.com
 // or it can be downloaded from github: https://github.com/crystalfontz/bmp_to_epaper
+//
+// Its arrays are raw planes, one bit per pixel, and are shown with
+// Load_Flash_Image_To_Display_RAM(). To save flash, run the header it
+// writes through tools/pack_images.py:
+//
+//   python3 tools/pack_images.py Images.h > Images_for_CFAP104212E00213.h
+//
+// Each NAME[] (or NAME_1BPP[]) becomes NAME_Packed[], which
+// Load_Packed_Flash_Image_To_Display_RAM() unpacks as it sends. The splash
+// screen's planes pack from 5512 bytes to 2606. Only packed images can be
+// shown rotated or mirrored.
 //=============================================================================
 
 // The display is SPI, include the library header.
@@ -83,281 +94,310 @@
 #define EPD_CS      10
 #define SD_CS       8
 
-#define ePaper_RST_0  (digitalWrite(EPD_RESET, LOW))
-#define ePaper_RST_1  (digitalWrite(EPD_RESET, HIGH))
-#define ePaper_CS_0   (digitalWrite(EPD_CS, LOW))
-#define ePaper_CS_1   (digitalWrite(EPD_CS, HIGH))
-#define ePaper_DC_0   (digitalWrite(EPD_DC, LOW))
-#define ePaper_DC_1   (digitalWrite(EPD_DC, HIGH))
+//A second panel on the same SPI bus, set to 1 if one is wired. Each panel
+//needs its own CS, DC, RESET and BUSY; D2 is the other pin with an
+//interrupt.
+#define SECOND_PANEL (0)
+#define EPD2_READY  2
+#define EPD2_RESET  7
+#define EPD2_DC     6
+#define EPD2_CS     9
+
+//SD card SPI clock, the panel's is EPD_SPI_HZ. Each device's transactions
+//use its own.
+#define SD_SPI_HZ   (8000000UL)
+
+//How 24-bit BMPs are brought down to three colours: DITHER_NONE for a hard
+//threshold, or DITHER_BAYER, DITHER_FLOYD or DITHER_ATKINSON to dither
+//them, see Convert_for_CFAP104212E00213.h
+#define BMP_DITHER  (DITHER_NONE)
+
+//Set to 1 to count bytes and chip select assertions sent to the controller
+#define EPD_BUS_STATS (0)
+//Set to 1 to time each panel operation, see reportStats()
+#define EPD_TIMING (0)
+//Set to 1 to take images over Serial from tools/epd_upload.py, at
+//EPD_UPLOAD_BAUD, instead of running the demos
+#define SERIAL_UPLOAD (0)
+
+// Pin and SPI bus layer, the pins above are fixed at compile time
+#include "Bus_for_CFAP104212E00213.h"
+typedef ePaperBus<EPD_CS, EPD_DC, EPD_RESET, EPD_READY> EPD;
+
+#include "Timing_for_CFAP104212E00213.h"
+
+// Interrupt driven BUSY, refreshes run while the sketch does other work
+#include "Async_for_CFAP104212E00213.h"
+typedef ePaperAsync<EPD> EPDAsync;
+
+#include "Convert_for_CFAP104212E00213.h"
+#include "Partial_for_CFAP104212E00213.h"
+#include "Packed_for_CFAP104212E00213.h"
+#include "Orient_for_CFAP104212E00213.h"
+#include "Text_for_CFAP104212E00213.h"
+#include "Fonts_for_CFAP104212E00213.h"
+#include "Render_for_CFAP104212E00213.h"
+#include "Pattern_for_CFAP104212E00213.h"
+#include "BMP_for_CFAP104212E00213.h"
+#include "Cache_for_CFAP104212E00213.h"
+
+// Waveform profiles, LUTs are only uploaded when they change
+#include "LUTManager_for_CFAP104212E00213.h"
+typedef ePaperLUT<EPD> EPDLUT;
+
+// Waveform profile and frame rate follow the panel temperature
+#include "Temperature_for_CFAP104212E00213.h"
+typedef ePaperTemperature<EPD> EPDTemp;
+
+// A panel type per controller and a scheduler that overlaps their refreshes
+#include "Panel_for_CFAP104212E00213.h"
+typedef ePaperPanel<EPD> EPDPanel;
+#if SECOND_PANEL
+typedef ePaperPanel<ePaperBus<EPD2_CS, EPD2_DC, EPD2_RESET, EPD2_READY> > EPDPanel2;
+#endif
+ePaperScheduler<EPD_MAX_PANELS> panels;
 
+// Power off or deep sleep between updates, with the MCU asleep too
+#include "Power_for_CFAP104212E00213.h"
+typedef ePaperPower<EPDPanel> EPDPower;
+#if SECOND_PANEL
+typedef ePaperPower<EPDPanel2> EPDPower2;
+#endif
 
-uint16_t HRES = 104;
-uint16_t VRES = 212;
+// Framed image uploads over Serial, streamed straight into the panel
+#include "Upload_for_CFAP104212E00213.h"
+#if SERIAL_UPLOAD
+ePaperUpload<EPDPanel> upload;
+#endif
 
 //=============================================================================
-//this function will take in a byte and send it to the display with the 
-//command bit low for command transmission
-void writeCMD(uint8_t command)
-{
-  ePaper_DC_0;
-  ePaper_CS_0;
-  SPI.transfer(command);
-  ePaper_CS_1;
-}
-
-//this function will take in a byte and send it to the display with the 
-//command bit high for data transmission
-void writeData(uint8_t data)
+// Bus statistics and timing
+//
+// With EPD_BUS_STATS set to 1 every byte and chip select assertion sent to
+// the controller is counted. The counters do not depend on the panel being
+// attached, so the cost of a transfer pattern can be compared on a bare board.
+//
+// With EPD_TIMING set to 1 the phases since the last report are also sent,
+// as CSV. Nothing is printed while the panel is being driven.
+//
+// EPD_HOST_REPORT(label) can be defined to mark the same points in a host
+// build, see host/bench.cpp.
+void reportStats(const char *label)
 {
-  ePaper_DC_1;
-  ePaper_CS_0;
-  SPI.transfer(data);
-  ePaper_CS_1;
+#if EPD_BUS_STATS
+  Serial.print(label);
+  Serial.print(": bytes=");
+  Serial.print(EPD::bytes);
+  Serial.print(" cs=");
+  Serial.println(EPD::cs_assertions);
+  EPD::bytes = 0;
+  EPD::cs_assertions = 0;
+#endif
+#if EPD_TIMING
+  Serial.println(label);
+  timingDumpCSV(Serial);
+#endif
+#ifdef EPD_HOST_REPORT
+  EPD_HOST_REPORT(label);
+#endif
+  (void)label;
 }
 
 //===========================================================================
 void setup(void)
 {
   //Debug port / Arduino Serial Monitor (optional)
+#if SERIAL_UPLOAD
+  Serial.begin(EPD_UPLOAD_BAUD);
+#else
   Serial.begin(9600);
+#endif
   Serial.println("setup started");
-  // Configure the pin directions   
-  pinMode(EPD_CS, OUTPUT);
-  pinMode(EPD_RESET, OUTPUT);
-  pinMode(EPD_DC, OUTPUT);
-  pinMode(EPD_READY, INPUT);
+  // Configure the pin directions. Both chip selects go high (deselected)
+  // before the bus starts, so neither device sees the other's traffic.
+  EPDPanel::begin();
+#if SECOND_PANEL
+  EPDPanel2::begin();
+#endif
   pinMode(SD_CS, OUTPUT);
+  digitalWrite(SD_CS, HIGH);
 
-  digitalWrite(SD_CS, LOW);
+  //Set up SPI interface. There is no bus wide setting: the panel and the
+  //SD library each open a transaction at their own clock per transfer.
+  SPI.begin();
 
-  if (!SD.begin(SD_CS))
+  if (!SD.begin(SD_SPI_HZ, SD_CS))
   {
     Serial.println("SD could not initialize");
   }
-  //Set up SPI interface
-  SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
-  SPI.begin();
+  else if (!cacheBegin(SD_SPI_HZ, SD_CS))
+  {
+    Serial.println("BMPs will not be cached");
+  }
 
 
   //reset driver
-  ePaper_RST_0;
-  delay(200);
-  ePaper_RST_1;
-  delay(200);
+  EPDPanel::reset();
 
   initEPD();
+  panels.add(EPDPanel::ops());
+#if SECOND_PANEL
+  EPDPanel2::reset();
+  EPDPanel2::init();
+  panels.add(EPDPanel2::ops());
+#endif
+
+  //Dither 24-bit BMPs only if BMP_DITHER asks for it
+  ditherBegin(BMP_DITHER);
   Serial.println("setup complete");
 }
 
 void initEPD()
 {
+  //power on, tri-color waveform and temperature, see ePaperPanel::init()
+  EPDPanel::init();
+}
 
-  //-----------------------------------------------------------------------------
-  //more detail on the following commands and additional commands not used here	
-  //can be found on the CFAP104212E0-0213 datasheet on the Crystalfontz website	
-  //-----------------------------------------------------------------------------
-
-  //Power Setting
-  writeCMD(0x01);
-  writeData(0x03);
-  writeData(0x00);
-  writeData(0x2B);
-  writeData(0x2B);
-  writeData(0x03);
-
-  //Booster Soft Start
-  writeCMD(0x06);
-  writeData(0x17);
-  writeData(0x17);
-  writeData(0x17);
-
-  //Power On
-  writeCMD(0x04);
-  Serial.println("before wait");
-  //wait until powered on
-  while (0 == digitalRead(EPD_READY));
-  Serial.println("after wait");
-
-  //Panel Setting 
-  writeCMD(0x00);
-  writeData(0x83);
-
-  //PLL Control
-  writeCMD(0x30);
-  writeData(0x3a);
-
-  //Resolution
-  writeCMD(0x61);
-  writeData(HRES);	
-  writeData(VRES>>8);	
-  writeData(VRES&0xff);
-
-  //VCOM_DC Setting
-  writeCMD(0x82);
-  writeData(0x28);
-
-  //Vcom and data interval setting
-  writeCMD(0x50);
-  writeData(0x87);
-
+//-----------------------------------------------------------------------------
+//Full refresh at the frame rate for the current temperature, then wait
+void refreshAndWait(void)
+{
+  EPDPanel::refresh();
+  EPDAsync::waitIdle();
 }
 
-void setRegisterLUT()
+//Count passes until the panel is idle, a measure of the time the sketch
+//has for other work while a refresh runs
+uint32_t spareLoops(void)
 {
-  //set LUTs
-  //The following block allows the LUTs to be changed.
-  //In order for these LUTs to take effect, command 0x00 must have bit 5 set to "1"
-  //set panel setting to call LUTs from the register
-  writeCMD(0x00);
-  writeData(0xb3);
-
-  //VCOM_LUT_LUTC
-  writeCMD(0x20);
-  for (int i = 0; i < 44; i++)
-  {
-    writeData(pgm_read_byte(&VCOM_LUT_LUTC[i]));
-  }
-  //W2W_LUT_LUTWW
-  writeCMD(0x21);
-  for (int i = 0; i < 42; i++)
-  {
-    writeData(pgm_read_byte(&W2W_LUT_LUTWW[i]));
-  }
-  //B2W_LUT_LUTBW_LUTR
-  writeCMD(0x22);
-  for (int i = 0; i < 42; i++)
+  uint32_t spare_loops = 0;
+  while (!EPDAsync::idle())
   {
-    writeData(pgm_read_byte(&B2W_LUT_LUTBW_LUTR[i]));
-  }
-  //W2B_LUT_LUTWB_LUTW
-  writeCMD(0x23);
-  for (int i = 0; i < 42; i++)
-  {
-    writeData(pgm_read_byte(&W2B_LUT_LUTWB_LUTW[i]));
-  }
-  //B2B_LUT_LUTBB_LUTB
-  writeCMD(0x24);
-  for (int i = 0; i < 42; i++)
-  {
-    writeData(pgm_read_byte(&B2B_LUT_LUTBB_LUTB[i]));
+    spare_loops++;
   }
+  return spare_loops;
+}
+
+//-----------------------------------------------------------------------------
+//Waveform selection goes through EPDLUT, which skips the upload when the
+//requested LUTs are already in the controller. See LUT_PROFILE[], and
+//TEMP_BAND[] for what is loaded instead at the panel's temperature.
+void setRegisterLUT()
+{
+  //black/white register LUTs, no yellow phases
+  EPDLUT::select(LUT_FAST_BW);
 }
 
 void setPartialRegisterLUT()
 {
-  //set LUTs
-  //The following block allows the LUTs to be changed.
-  //In order for these LUTs to take effect, command 0x00 must have bit 5 set to "1"
-  //set panel setting to call LUTs from the register
-  writeCMD(0x00);
-  writeData(0xb3);
-
-  //VCOM_LUT_LUTC
-  writeCMD(0x20);
-  for (int i = 0; i < 44; i++)
-  {
-    writeData(pgm_read_byte(&VCOM_LUT_LUTC_PARTIAL[i]));
-  }
-  //W2W_LUT_LUTWW
-  writeCMD(0x21);
-  for (int i = 0; i < 42; i++)
-  {
-    writeData(pgm_read_byte(&W2W_LUT_LUTWW_PARTIAL[i]));
-  }
-  //B2W_LUT_LUTBW_LUTR
-  writeCMD(0x22);
-  for (int i = 0; i < 42; i++)
-  {
-    writeData(pgm_read_byte(&B2W_LUT_LUTBW_LUTR_PARTIAL[i]));
-  }
-  //W2B_LUT_LUTWB_LUTW
-  writeCMD(0x23);
-  for (int i = 0; i < 42; i++)
-  {
-    writeData(pgm_read_byte(&W2B_LUT_LUTWB_LUTW_PARTIAL[i]));
-  }
-  //B2B_LUT_LUTBB_LUTB
-  writeCMD(0x24);
-  for (int i = 0; i < 42; i++)
-  {
-    writeData(pgm_read_byte(&B2B_LUT_LUTBB_LUTB_PARTIAL[i]));
-  }
+  EPDLUT::select(LUT_PARTIAL);
 }
 
 void setOTPLUT()
 {
   //set panel setting to call LUTs from OTP
-  //These are the original settings in the init block
-  writeCMD(0x00);
-  writeData(0x93); 
+  EPDLUT::select(LUT_OTP_BW);
 }
 
+//Row source for partialUpdateSolid(), context points at the two plane bytes
+void solidRowSource(uint8_t plane, uint16_t /*y*/, uint8_t /*first_byte*/,
+  uint8_t count, uint8_t *bytes, void *context)
+{
+  memset(bytes, ((const uint8_t *)context)[plane], count);
+}
+
+//Fill the pixels x1..x2, y1..y2 (inclusive) with one byte per plane
 void partialUpdateSolid(uint8_t x1, uint16_t y1, uint8_t x2, uint16_t y2, uint8_t color1, uint8_t color2)
 {
-  //turn on partial update mode
-  writeCMD(0x91);
-
-  writeCMD(0x90);
-  writeData(((x1 / 8) << 1) | 0x07);	//x1
-  writeData(((x2 / 8) << 1));	//x2
-  writeData(y1 >> 8);	  //1st half y1
-  writeData(y1 & 0xff);	//2nd half y1
-  writeData(y2 >> 8);	  //1st half y2
-  writeData(y2 & 0xff);	//2nd half y2
-  writeData(0x01);
-
-  int i;
-  int h;
-  //send black and white information
-  writeCMD(0x10);
-  for (h = 0; h < y2 - y1; h++)
+  uint8_t colors[2] = { color1, color2 };
+  ePaperDirty dirty;
+  dirty.mark(x1, y1, x2, y2);
+  partialUpdateWindows<EPD>(dirty, solidRowSource, colors);
+}
+
+//Row source that unpacks from a full screen packed PROGMEM image pair,
+//context points at an ePaperUnpacker for each plane
+void packedRowSource(uint8_t plane, uint16_t y, uint8_t first_byte,
+  uint8_t count, uint8_t *bytes, void *context)
+{
+  ePaperUnpacker &image = ((ePaperUnpacker *)context)[plane];
+  image.seek(y * WIDTH_MONO_BYTES + first_byte);
+  image.read(bytes, count);
+}
+
+//================================================================================
+//Raw planes straight from bmp_to_epaper, upright
+void Load_Flash_Image_To_Display_RAM(uint16_t width_pixels,
+  uint16_t height_pixels,
+  const uint8_t *BW_image,
+  const uint8_t *Y_image)
+{
+  //Get width_bytes from width_pixel, rounding up
+  uint8_t
+    width_bytes;
+  width_bytes = (width_pixels + 7) >> 3;
+  uint16_t
+    image_bytes;
+  image_bytes = (uint16_t)width_bytes * height_pixels;
+
+  //Make sure the display is not busy before starting a new command.
+  EPDAsync::waitReady();
+
+  //DATA START TRANSMISSION 1 (DTM1) (R10H), BW data, then
+  //DATA START TRANSMISSION 2 (DTM2) (R13H), yellow data, each one burst
+  //from flash. See Load_Packed_Flash_Image_To_Display_RAM() below.
   {
-    for (i = 0; i < (x2 - x1) / 8; i++)
-    {
-      writeData(color1);
-    }
+    EPD_TIMED(TIMING_PLANE, 0x10);
+    EPD::writeCMDData_Flash(0x10, BW_image, image_bytes);
   }
-  //send yellow information
-  writeCMD(0x13); 
-  for (h = 0; h < y2 - y1; h++)
   {
-    for (i = 0; i < (x2 - x1) / 8; i++)
-    {
-      writeData(color2);
-    }
+    EPD_TIMED(TIMING_PLANE, 0x13);
+    EPD::writeCMDData_Flash(0x13, Y_image, image_bytes);
   }
 
-  //partial refresh of the same area as the partial update
-  writeCMD(0x12);
-  while (0 == digitalRead(EPD_READY));
-
-  //turn off partial update mode
-  writeCMD(0x92);
+  //Write the command: DATA STOP (DSP) (R11H)
+  EPD::writeCMD(0x11);
+  //Write the command: Display Refresh (DRF), the refresh runs on while
+  //the caller carries on, see EPDAsync
+  EPDPanel::refresh();
 }
 
 //================================================================================
-void Load_Flash_Image_To_Display_RAM(uint16_t width_pixels,
+//Planes packed by tools/pack_images.py, in any orientation
+void Load_Packed_Flash_Image_To_Display_RAM(uint16_t width_pixels,
   uint16_t height_pixels,
   const uint8_t *BW_image,
-  const uint8_t *Y_image)
+  const uint8_t *Y_image,
+  uint8_t orientation)
 {
-  //Index into *image, that works with pgm_read_byte()
-  uint16_t
-    index;
-  index = 0;
+  //A rotated or mirrored image (width_pixels x height_pixels must match the
+  //orientation) goes in band by band, see Orient_for_CFAP104212E00213.h
+  if (orientation != ROTATE_0)
+  {
+    if ((width_pixels != orientWidth(orientation)) ||
+        (height_pixels != orientHeight(orientation)))
+    {
+      return;
+    }
+    loadPackedOriented<EPD>(orientation, BW_image, Y_image);
+    EPDPanel::refresh();
+    return;
+  }
 
   //Get width_bytes from width_pixel, rounding up
   uint8_t
     width_bytes;
   width_bytes = (width_pixels + 7) >> 3;
 
+  //Both planes are packed (see Packed_for_CFAP104212E00213.h) and sent as
+  //one burst each
+  uint16_t
+    image_bytes;
+  image_bytes = (uint16_t)width_bytes * height_pixels;
+
   //Make sure the display is not busy before starting a new command.
-  while (0 == digitalRead(EPD_READY));
-  //Select the controller   
-  ePaper_CS_0;
+  EPDAsync::waitReady();
 
-  //Aim at the command register
-  ePaper_DC_0;
   //Write the command: DATA START TRANSMISSION 1 (DTM2) (R13H)
   //  Display Start transmission 1
   //  (DTM1, BW Data)
@@ -365,23 +405,16 @@ void Load_Flash_Image_To_Display_RAM(uint16_t width_pixels,
   // This command starts transmitting data and write them into SRAM. To complete
   // data transmission, command DSP (Data transmission Stop) must be issued. Then
   // the chip will start to send data/VCOM for panel.
-  //  * In B/W mode, this command writes OLD data to SRAM.
-  //  * In B/W/Yellow mode, this command writes BW data to SRAM.
-  SPI.transfer(0x10);
-  //Pump out the BW data.
-  ePaper_DC_1;
-  index = 0;
-  for (uint16_t y = 0; y<height_pixels; y++)
+  //  * In B/W mode, this command writes �OLD� data to SRAM.
+  //  * In B/W/Yellow mode, this command writes �BW� data to SRAM.
   {
-    for (uint8_t x = 0; x<width_bytes; x++)
-    {
-      SPI.transfer(pgm_read_byte(&BW_image[index]));
-      index++;
-    }
+    EPD_TIMED(TIMING_PLANE, 0x10);
+    EPD::beginCMD(0x10);
+    //Unpack the BW data into the stream.
+    streamPacked<EPD>(BW_image, image_bytes);
+    EPD::endTransfer();
   }
 
-  //Aim at the command register
-  ePaper_DC_0;
   //Write the command: DATA START TRANSMISSION 2 (DTM2) (R13H)
   //  Display Start transmission 2
   //  (DTM2, Yellow Data)
@@ -389,29 +422,21 @@ void Load_Flash_Image_To_Display_RAM(uint16_t width_pixels,
   // This command starts transmitting data and write them into SRAM. To complete
   // data transmission, command DSP (Data transmission Stop) must be issued. Then
   // the chip will start to send data/VCOM for panel.
-  //  * In B/W mode, this command writes NEW data to SRAM.
-  //  * In B/W/Yellow mode, this command writes Yellow data to SRAM.
-  SPI.transfer(0x13);
-  //Pump out the Yellow data.
-  ePaper_DC_1;
-  index = 0;
-  for (uint16_t y = 0; y<height_pixels; y++)
+  //  * In B/W mode, this command writes �NEW� data to SRAM.
+  //  * In B/W/Yellow mode, this command writes �Yellow� data to SRAM.
   {
-    for (uint8_t x = 0; x<width_bytes; x++)
-    {
-      SPI.transfer(pgm_read_byte(&Y_image[index]));
-      index++;
-    }
+    EPD_TIMED(TIMING_PLANE, 0x13);
+    EPD::beginCMD(0x13);
+    //Unpack the Yellow data into the stream.
+    streamPacked<EPD>(Y_image, image_bytes);
+    EPD::endTransfer();
   }
 
-  //Aim back at the command register
-  ePaper_DC_0;
   //Write the command: DATA STOP (DSP) (R11H)
-  SPI.transfer(0x11);
-  //Write the command: Display Refresh (DRF)   
-  SPI.transfer(0x12);
-  //Deslect the controller   
-  ePaper_CS_1;
+  EPD::writeCMD(0x11);
+  //Write the command: Display Refresh (DRF), the refresh runs on while
+  //the caller carries on, see EPDAsync
+  EPDPanel::refresh();
 }
 
 //================================================================================
@@ -446,71 +471,25 @@ void show_BMPs_in_root(void)
       //The file name must include ".BMP"
       if (0 != strstr(bmp_file.name(), ".BMP"))
       {
-        //The BMP must be exactly 36918 long
-        //(this is correct for182x96, 24-bit)
-        uint32_t size = bmp_file.size();
+        Serial.println(bmp_file.size());
 
-        Serial.println(size);
-        if (HRES*VRES * 3 <= size)
+        //The first time, read the file once, loading both planes band by
+        //band and saving them as NAME.EPD. After that the .EPD is streamed
+        //as it is. The controller is deselected between reads so the SD
+        //card can use the bus.
+        if (loadCachedBMP<EPD>(bmp_file))
         {
-          Serial.println("made it");
-
-
-          //Make sure the display is not busy before starting a new command.
-          while (0 == digitalRead(EPD_READY));
-          //Select the controller   
-          ePaper_CS_0;
-
-          writeCMD(0x10);
-          //Jump over BMP header
-          bmp_file.seek(54);
-          //grab one row of pixels from the SD card at a time
-          static uint8_t one_line[104 * 3];
-          for (int line = 0; line < 212; line++)
-          {
-
-            //Set the LCD to the left of this line. BMPs store data
-            //to have the image drawn from the other end, uncomment the line below
-
-            //read a line from the SD card
-            bmp_file.read(one_line, 104 * 3);
-
-            //send the line to the display
-            send_pixels_BW(104 * 3, one_line);
-          }
-          Serial.println("halfway");
-
-          writeCMD(0x13);
-          //Jump over BMP header
-          bmp_file.seek(54);
-          //grab one row of pixels from the SD card at a time
-          for (int line = 0; line < 212; line++)
-          {
-
-            //Set the LCD to the left of this line. BMPs store data
-            //to have the image drawn from the other end, uncomment the line below
-
-            //read a line from the SD card
-            bmp_file.read(one_line, 104 * 3);
-
-            //send the line to the display
-            send_pixels_Y(104 * 3, one_line);
-          }
-
           Serial.println("refreshing......");
-          //Give a bit to let them see it
-          //Make sure the display is not busy before starting a new command.
-          //Aim back at the command register
-          ePaper_DC_0;
-          //Write the command: DATA STOP (DSP) (R11H)
-          SPI.transfer(0x11);
           //Write the command: Display Refresh (DRF)   
-          SPI.transfer(0x12);
-          //Deslect the controller   
-          ePaper_CS_1;
-          while (0 == digitalRead(EPD_READY));
+          refreshAndWait();
+          reportStats(bmp_file.name());
+          //Give a bit to let them see it
           delay(30000);
         }
+        else
+        {
+          Serial.println("not a usable BMP");
+        }
       }
     }
     //Release the BMP file handle
@@ -520,280 +499,260 @@ void show_BMPs_in_root(void)
   root_dir.close();
 }
 
-//================================================================================
-void send_pixels_BW(uint16_t byteCount, uint8_t *dataPtr)
+//=============================================================================
+//Job for the splash screen: load both planes and start the refresh,
+//context points at the orientation
+void splashJob(void *context)
 {
-  uint8_t data;
-  uint8_t red;
-  uint8_t green;
-  uint8_t blue;
-  while (byteCount != 0)
-  {
-    uint8_t data = 0;
-    red = *dataPtr;
-    dataPtr++;
-    byteCount--;
-    green = *dataPtr;
-    dataPtr++;
-    byteCount--;
-    blue = *dataPtr;
-    dataPtr++;
-    byteCount--;
-
-    //check to see if pixel should be set as black or white
-    if (127 < ((red*.21) + (green*.72) + (blue*.07)))
-    {
-      data = data | 0x01;
-    }
+  Load_Packed_Flash_Image_To_Display_RAM(104, 212, Splash_Mono_Packed, Splash_Yellow_Packed,
+                                         *(const uint8_t *)context);
+}
 
-    for (uint8_t i = 0; i < 7; i++)
-    {
-      red = *dataPtr;
-      dataPtr++;
-      byteCount--;
-      green = *dataPtr;
-      dataPtr++;
-      byteCount--;
-      blue = *dataPtr;
-      dataPtr++;
-      byteCount--;
-      data = data << 1;
-
-      //check to see if pixel should be set as black or white
-      if (127 < ((red*.21) + (green*.72) + (blue*.07)))
-      {
-        data = data | 0x01;
-      }
-      else
-      {
-        data = data & 0xFE;
-      }
-    }
-    writeData(data);
-  }
+//Called from EPDAsync::service() once the splash refresh is done
+void splashDone(void * /*context*/)
+{
+  Serial.println("refresh complete");
 }
 
-//================================================================================
-void send_pixels_Y(uint8_t byteCount, uint8_t *dataPtr)
+//Power off every panel, or put every panel into deep sleep
+void shutdownPanels(bool deep)
 {
-  uint8_t data;
-  uint8_t red;
-  uint8_t green;
-  uint8_t blue;
-  while (byteCount != 0)
+  if (deep)
   {
-    uint8_t data = 0;
-    blue = *dataPtr;
-    dataPtr++;
-    byteCount--;
-    green = *dataPtr;
-    dataPtr++;
-    byteCount--;
-    red = *dataPtr;
-    dataPtr++;
-    byteCount--;
-
-    //check to see if pixel should be set as yellow
-    if ((228 < red) && (208 < green) && (blue < 250))
-    {
-      //data |= 0x01;
-    }
-
-    for (uint8_t i = 0; i < 7; i++)
-    {
-      blue = *dataPtr;
-      dataPtr++;
-      byteCount--;
-      green = *dataPtr;
-      dataPtr++;
-      byteCount--;
-      red = *dataPtr;
-      dataPtr++;
-      byteCount--;
-      data = data << 1;
-
-      //check to see if pixel should be set as yellow
-      if ((228 < red) && (208 < green) && (blue < 250))
-      {
-        //data |= 0x01;
-      }
-      else
-      {
-        //data &= 0xFE;
-      }
-    }
-    writeData(data);
+    EPDPower::deepSleep();
+#if SECOND_PANEL
+    EPDPower2::deepSleep();
+#endif
+  }
+  else
+  {
+    EPDPower::powerOff();
+#if SECOND_PANEL
+    EPDPower2::powerOff();
+#endif
   }
 }
 
+//Every panel back to POWER_ON
+void wakePanels(void)
+{
+  EPDPower::wake();
+#if SECOND_PANEL
+  EPDPower2::wake();
+#endif
+}
+
 //=============================================================================
+//After each pass of loop(): 0 leaves the panels powered, POWER_OFF turns
+//them all off and POWER_SLEEP puts them all into deep sleep. Either way the
+//MCU then sleeps for SLEEP_SECONDS.
 #define SHUTDOWN_BETWEEN_UPDATES (0)
+#define SLEEP_SECONDS (60)
 #define splashscreen 1
 #define white 1
 #define black 1
 #define yellow 1
 #define checkerboard 1
 #define partialUpdate 1
+#define bandedRender 1
+#define textCounter 1
 #define showBMPs 0
 void loop()
 {
+#if SERIAL_UPLOAD
+  //frames are handled as they arrive, refreshes run in the background
+  upload.service(Serial);
+  return;
+#endif
 
 #if splashscreen
   Serial.println("top of loop");
-  //load an image to the display
-  Load_Flash_Image_To_Display_RAM(104, 212, Splash_Mono_1BPP, Splash_Yellow_1BPP);
-
+  //every other pass the splash is shown upside down, rotated band by band
+  static uint8_t splash_orientation = ROTATE_0;
+  //load an image to the display, the refresh runs in the background
+  EPDAsync::submit(splashJob, &splash_orientation, splashDone);
 
   Serial.print("refreshing . . . ");
-  while (0 == digitalRead(EPD_READY));
-  Serial.println("refresh complete");
+  //anything can run here while the panel refreshes
+  Serial.print(spareLoops());
+  Serial.println(" loops spare");
+  reportStats("splash");
+  splash_orientation ^= ROTATE_180;
   //wait for 20sec before refreshing again
   delay(20000);
 #endif
 
 #if white
-  //start data transmission 1
-  writeCMD(0x10);
-  for (int i = 0; i < VRES*HRES/8; i++)
-  {
-    writeData(0x00);
-  }
-  //start data transmission 2
-  writeCMD(0x13);
-  for (int i = 0; i < VRES*HRES / 8; i++)
-  {
-    writeData(0x00);
-  }
+  //start data transmission 1 and 2, each plane is one fill
+  writePatterns<EPD>(solidPattern(0x00), solidPattern(0x00));
   //refresh the display
-  Serial.println("before refresh wait");
-  writeCMD(0x12);
-  while (0 == digitalRead(EPD_READY));
-  Serial.println("after refresh wait");
+  refreshAndWait();
+  reportStats("white");
   delay(2000);
 #endif
 
 
 #if black
-
-
-  //start data transmission 1
-  writeCMD(0x10);
-  for (int i = 0; i < VRES*HRES / 8; i++)
-  {
-    writeData(0xff);
-  }
-  //start data transmission 2
-  writeCMD(0x13);
-  for (int i = 0; i < VRES*HRES / 8; i++)
-  {
-    writeData(0x00);
-  }
-  Serial.println("before refresh wait");
+  writePatterns<EPD>(solidPattern(0xff), solidPattern(0x00));
   //refresh the display
-  writeCMD(0x12);
-  while (0 == digitalRead(EPD_READY));
-  Serial.println("after refresh wait");
+  refreshAndWait();
+  reportStats("black");
   delay(2000);
 #endif
 
 #if yellow
-  //start data transmission 1
-  writeCMD(0x10);
-  for (int i = 0; i < VRES*HRES / 8; i++)
-  {
-    writeData(0x00);
-  }
-  //start data transmission 2
-  writeCMD(0x13);
-  for (int i = 0; i < VRES*HRES / 8; i++)
-  {
-    writeData(0xff);
-  }
-  Serial.println("before refresh wait");
+  writePatterns<EPD>(solidPattern(0x00), solidPattern(0xff));
   //refresh the display
-  writeCMD(0x12);
-  while (0 == digitalRead(EPD_READY));
-  Serial.println("after refresh wait");
+  refreshAndWait();
+  reportStats("yellow");
   delay(20000);
 #endif
 
 #if checkerboard
-  //color1 is for the bw data, color2 is for the yellow data
-  uint8_t color1 = 0x00;
-  uint8_t color2 = 0xff;
+  //black and yellow 8x8 cells: the yellow plane is the black plane inverted
+  writePatterns<EPD>(makePattern(PATTERN_CHECKER, 8),
+                     makePattern(PATTERN_CHECKER, 8, true));
 
-  //start data transmission 1
-  writeCMD(0x10);
-  for (int i = 0; i < 212; i++)
-  {
-    color1 = ~color1;
-    //every 8 rows, change the color
-    if (i % 8 == 0)
-    {
-      color1 = ~color1;
-    }
-    //run for 13 loops to complete a row --- 104 / 8 = 13
-    for (uint8_t j = 0; j < 13; j++)
-    {
-      writeData(color1);
-      //every 8 pixels, change the color
-      color1 = ~color1;
-    }
-  }
-  writeCMD(0x13);
-  for (int i = 0; i < 212; i++)
-  {
-    color2 = ~color2;
-    if (i % 8 == 0)
-    {
-      color2 = ~color2;
-    }
-    for (uint8_t j = 0; j < 13; j++)
-    {
-      writeData(color2);
-      color2 = ~color2;
-    }
-}
-
-  Serial.println("before refresh wait");
   //refresh the display
-  writeCMD(0x12);
-  while (0 == digitalRead(EPD_READY));
-  Serial.println("after refresh wait");
+  refreshAndWait();
+  reportStats("checkerboard");
   delay(20000);
 #endif
 
 #if partialUpdate
+  //each refresh runs in the background, the next update waits for it
   partialUpdateSolid(50, 24, 100, 100, 0xff, 0x00);
-  while (0 == digitalRead(EPD_READY));
   delay(1000);
 
   partialUpdateSolid(50, 24, 100, 100, 0x00, 0x00);
-  while (0 == digitalRead(EPD_READY));
   delay(1000);
 
   partialUpdateSolid(50, 24, 100, 100, 0xff, 0xff);
-  while (0 == digitalRead(EPD_READY));
   delay(1000);
 
   partialUpdateSolid(50, 24, 100, 100, 0x00, 0xff);
-  while (0 == digitalRead(EPD_READY));
+  Serial.print(spareLoops());
+  Serial.println(" loops spare");
+  reportStats("partial");
+  delay(1000);
+
+  //put two pieces of the splash screen back, only those windows are sent
+  ePaperUnpacker splash[2];
+  splash[0].begin(Splash_Mono_Packed);
+  splash[1].begin(Splash_Yellow_Packed);
+  ePaperDirty dirty;
+  dirty.mark(8, 150, 47, 181);
+  dirty.mark(56, 150, 95, 181);
+  partialUpdateWindows<EPD>(dirty, packedRowSource, splash);
+  EPDAsync::waitIdle();
+  reportStats("partial splash");
   delay(1000);
   #endif
 
+#if bandedRender
+  //Draw with no frame buffer: the display list is rasterized a band of
+  //rows at a time into the image decoders' band buffers and streamed to the
+  //controller
+  static ePaperCanvas<8> canvas;
+  canvas.clear();
+  canvas.fillRect(4, 4, 99, 20, EPD_YELLOW);
+  canvas.frameRect(2, 2, 101, 22, EPD_BLACK);
+  canvas.line(0, 211, 103, 110, EPD_BLACK);
+  canvas.text(8, 30, "Crystalfontz", Font_Small, EPD_BLACK);
+
+  EPD_RenderStats stats;
+  renderBands<EPD>(canvas, &stats);
+  Serial.print("bands ");
+  Serial.print(stats.bands);
+  Serial.print(" raster us ");
+  Serial.print(stats.raster_us);
+  Serial.print(" send us ");
+  Serial.println(stats.send_us);
+  refreshAndWait();
+  delay(20000);
+
+  //one more item: only its area is rasterized and sent
+  canvas.fillRect(40, 8, 63, 16, EPD_BLACK);
+  renderDirty<EPD>(canvas);
+  EPDAsync::waitIdle();
+  reportStats("banded render");
+  delay(1000);
+
+  //the same drawing calls in landscape, 212 x 104
+  canvas.clear();
+  canvas.setOrientation(ROTATE_90);
+  canvas.frameRect(0, 0, 211, 103, EPD_BLACK);
+  canvas.fillRect(8, 8, 120, 40, EPD_YELLOW);
+  canvas.line(0, 103, 211, 0, EPD_BLACK);
+  canvas.text(12, 12, "212 x 104", Font_Large, EPD_BLACK);
+  renderBands<EPD>(canvas, &stats);
+  refreshAndWait();
+  reportStats("landscape render");
+  canvas.setOrientation(ROTATE_0);
+  delay(20000);
+#endif
+
+#if textCounter
+  //A number counting up in a box of its own: each new value is drawn
+  //straight into the box's partial window, one row at a time
+  {
+    static ePaperTextField counter =
+      { &Font_Large, 24, 96, 56, EPD_BLACK, TEXT_CENTER, "" };
+    char digits[6];
+    for (uint8_t i = 0; i < 5; i++)
+    {
+      utoa(1000 + i * 111, digits, 10);
+      uint32_t latency = updateTextField<EPD>(counter, digits);
+      Serial.print(digits);
+      Serial.print(" us to refresh: ");
+      Serial.println(latency);
+      delay(1000);
+    }
+    EPDAsync::waitIdle();
+    reportStats("text counter");
+  }
+#endif
+
+#if SECOND_PANEL
+  //The splash on both panels. The second is loaded while the first
+  //refreshes, so the pair takes about one refresh, not two.
+  {
+    static EPD_PackedImage both = { Splash_Mono_Packed, Splash_Yellow_Packed, ROTATE_0 };
+    uint32_t start = millis();
+    panels.submit(0, packedImageJob<EPDPanel>, &both);
+    panels.submit(1, packedImageJob<EPDPanel2>, &both);
+    panels.waitIdle();
+    Serial.print("two panels in ms: ");
+    Serial.println(millis() - start);
+    reportStats("two panels");
+    delay(20000);
+  }
+#endif
+
 #if showBMPs
 
 
   //Panel Setting 
-  //writeCMD(0x00);
-  //writeData(0x8b);
+  //EPD::writeCMD(0x00);
+  //EPD::writeData(0x8b);
 
   show_BMPs_in_root();
   delay(30000);
   //Panel Setting 
-  //writeCMD(0x00);
-  //writeData(0x83);
+  //EPD::writeCMD(0x00);
+  //EPD::writeData(0x83);
+
+#endif
 
+#if SHUTDOWN_BETWEEN_UPDATES
+  shutdownPanels(SHUTDOWN_BETWEEN_UPDATES == POWER_SLEEP);
+  //let the last prints go out before the UART stops
+  Serial.flush();
+  EPDPower::sleepMCU(SLEEP_SECONDS);
+  uint32_t wake_start = micros();
+  wakePanels();
+  Serial.print("awake, us: ");
+  Serial.println(micros() - wake_start);
 #endif
 
 }
@@ -0,0 +1,282 @@
+#ifndef __CACHE_FOR_CFAP104212E00213_H__
+#define __CACHE_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Native image cache
+//
+// A 24 bit BMP is about 66 KB to read and convert; the two planes it turns
+// into are 5.5 KB. The first time a BMP is shown, loadCachedBMP() writes
+// those planes next to it as NAME.EPD, and later displays stream the .EPD
+// straight into 0x10 and 0x13 with no per-pixel work.
+//
+// .EPD layout, little endian: an EPD_CacheHeader, then the BW plane and the
+// yellow plane, each height rows of (width + 7) / 8 bytes, top to bottom.
+// The planes are kept as the BMP has them, so a rotated image is cached
+// landscape and rotated again as it is loaded.
+//
+// A cache remembers its source's size and modify date and time, from the
+// BMP's directory entry, and the dither it was made with. If any of those
+// change the cache is stale and is rebuilt. A hit reads one directory block
+// and the .EPD, never the BMP. The magic is written last, and only if every
+// write succeeded, so a cache cut short by a reset or a full card is never
+// used.
+//
+// The SD library's File does not show its directory entry, so
+// cacheBegin() mounts the card a second time through the SdFat classes the
+// library is built on, and sourceStamp() looks BMPs in the root directory
+// up there with SdFile::dirEntry(). The two mounts share SdVolume's block
+// cache, so they always agree. If cacheBegin() was not called or failed,
+// BMPs are loaded without a cache.
+//=============================================================================
+#include <SD.h>
+
+//Open for random writes (FILE_WRITE appends, whatever the position)
+#define EPD_CACHE_WRITE (O_READ | O_WRITE | O_CREAT | O_TRUNC)
+
+struct EPD_CacheHeader
+{
+  //"EPD3" (older caches were checked on a CRC of the source)
+  char     magic[4];
+  uint16_t width;
+  uint16_t height;
+  uint32_t bw_offset;
+  uint32_t yellow_offset;
+  //what the cache was made from: size and FAT modify date and time
+  uint32_t source_size;
+  uint16_t source_date;
+  uint16_t source_time;
+  //dither_mode it was converted with
+  uint8_t  dither;
+  uint8_t  reserved[3];
+};
+
+//The second mount, see above
+static Sd2Card  epd_cache_card;
+static SdVolume epd_cache_volume;
+static SdFile   epd_cache_root;
+
+//Mount the card for sourceStamp(), with the clock and chip select given to
+//SD.begin() and after it. Returns false if caching is not possible.
+bool cacheBegin(uint32_t clock, uint8_t cs)
+{
+  //the same steps as SD.begin()
+  return epd_cache_card.init(SPI_HALF_SPEED, cs) &&
+         epd_cache_card.setSpiClock(clock) &&
+         epd_cache_volume.init(&epd_cache_card) &&
+         epd_cache_root.openRoot(&epd_cache_volume);
+}
+
+//Size and modify date and time of a file in the root directory, from its
+//directory entry. False if it cannot be found.
+static bool sourceStamp(const char *name, EPD_CacheHeader &header)
+{
+  if (!epd_cache_root.isOpen())
+  {
+    return false;
+  }
+  SdFile file;
+  dir_t entry;
+  bool ok = file.open(&epd_cache_root, name, O_READ) && file.dirEntry(&entry);
+  file.close();
+  if (ok)
+  {
+    header.source_size = entry.fileSize;
+    header.source_date = entry.lastWriteDate;
+    header.source_time = entry.lastWriteTime;
+  }
+  return ok;
+}
+
+//CRC-16/CCITT of each nibble value, for crc16()
+const uint16_t CRC16_NIBBLE[16] PROGMEM =
+{
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+  0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+};
+
+//CRC-16/CCITT, a nibble at a time: a 32 byte table instead of 512, and
+//about four times faster than a bit at a time
+static uint16_t crc16(uint16_t crc, const uint8_t *data, uint16_t n)
+{
+  while (n != 0)
+  {
+    uint8_t b = *data++;
+    crc = (crc << 4) ^ pgm_read_word(&CRC16_NIBBLE[(crc >> 12) ^ (b >> 4)]);
+    crc = (crc << 4) ^ pgm_read_word(&CRC16_NIBBLE[(crc >> 12) ^ (b & 0x0f)]);
+    n--;
+  }
+  return crc;
+}
+
+//NAME.BMP -> NAME.EPD, false if name has no .BMP
+static bool cacheName(const char *bmp_name, char *cache_name, uint8_t size)
+{
+  const char *ext = strstr(bmp_name, ".BMP");
+  if ((ext == 0) || (size < (ext - bmp_name) + 5))
+  {
+    return false;
+  }
+  uint8_t base = ext - bmp_name;
+  memcpy(cache_name, bmp_name, base);
+  strcpy(cache_name + base, ".EPD");
+  return true;
+}
+
+//Stream both planes of an open .EPD into the controller's RAM. The panel is
+//not refreshed. The planes must be orientWidth() x orientHeight().
+template<class BUS>
+bool loadEPD(File &file, const EPD_CacheHeader &header, uint8_t orientation)
+{
+  if ((header.width != orientWidth(orientation)) ||
+      (header.height != orientHeight(orientation)))
+  {
+    return false;
+  }
+  if (orientation != ROTATE_0)
+  {
+    //a band of each plane at a time
+    uint8_t row_bytes = orientRowBytes(orientation);
+    bool ok = true;
+    beginBands<BUS>();
+    for (uint16_t sy = 0; ok && (sy < header.height); sy += EPD_BAND_ROWS)
+    {
+      uint8_t rows = (header.height - sy < EPD_BAND_ROWS) ? (header.height - sy) : EPD_BAND_ROWS;
+      uint16_t n = (uint16_t)rows * row_bytes;
+      uint32_t at = (uint32_t)sy * row_bytes;
+      {
+        EPD_TIMED(TIMING_SD, rows);
+        ok = file.seek(header.bw_offset + at) && (n == file.read(epd_band_bw, n)) &&
+             file.seek(header.yellow_offset + at) && (n == file.read(epd_band_yellow, n));
+      }
+      if (ok)
+      {
+        writeOrientedBand<BUS>(orientation, sy, rows, epd_band_bw, epd_band_yellow);
+      }
+    }
+    endBands<BUS>();
+    return ok;
+  }
+  //upright planes go straight in, the band buffer is the chunk
+  uint8_t *chunk = epd_band_bw;
+  const uint16_t chunk_size = sizeof(epd_band_bw);
+  for (uint8_t plane = 0; plane < 2; plane++)
+  {
+    uint8_t command = plane ? 0x13 : 0x10;
+    EPD_TIMED(TIMING_PLANE, command);
+    if (!file.seek(plane ? header.yellow_offset : header.bw_offset))
+    {
+      return false;
+    }
+    ePaperAsync<BUS>::waitReady();
+    BUS::beginCMD(command);
+    BUS::endTransfer();
+    uint16_t left = EPD_PLANE_BYTES;
+    while (left != 0)
+    {
+      uint16_t n = (left < chunk_size) ? left : chunk_size;
+      //the panel is deselected while the card has the bus
+      if (n != file.read(chunk, n))
+      {
+        return false;
+      }
+      BUS::beginData();
+      BUS::streamBuffer(chunk, n);
+      BUS::endTransfer();
+      left -= n;
+    }
+  }
+  return true;
+}
+
+//Load bmp into the controller's RAM through its .EPD, making the .EPD first
+//if it is missing or stale. The panel is not refreshed. Returns false if the
+//BMP is not usable.
+template<class BUS>
+bool loadCachedBMP(File &bmp, uint8_t orientation = ROTATE_0)
+{
+  char name[13];
+  if (!cacheName(bmp.name(), name, sizeof(name)))
+  {
+    return loadBMP<BUS>(bmp, orientation);
+  }
+  uint16_t plane_bytes = (uint16_t)orientRowBytes(orientation) * orientHeight(orientation);
+
+  EPD_CacheHeader source;
+  if (!sourceStamp(bmp.name(), source))
+  {
+    return loadBMP<BUS>(bmp, orientation);
+  }
+
+  EPD_CacheHeader header;
+  File cache = SD.open(name, FILE_READ);
+  if (cache)
+  {
+    bool fresh =
+      (sizeof(header) == cache.read((uint8_t *)&header, sizeof(header))) &&
+      (0 == memcmp(header.magic, "EPD3", 4)) &&
+      (header.source_size == source.source_size) &&
+      (header.source_date == source.source_date) &&
+      (header.source_time == source.source_time) &&
+      (header.dither == dither_mode);
+    if (fresh && loadEPD<BUS>(cache, header, orientation))
+    {
+      cache.close();
+      return true;
+    }
+    cache.close();
+    SD.remove(name);
+  }
+
+  //(Re)build the cache while the BMP is shown
+  memset(&header, 0, sizeof(header));
+  header.width = orientWidth(orientation);
+  header.height = orientHeight(orientation);
+  header.bw_offset = sizeof(header);
+  header.yellow_offset = sizeof(header) + plane_bytes;
+  header.source_size = source.source_size;
+  header.source_date = source.source_date;
+  header.source_time = source.source_time;
+  header.dither = dither_mode;
+
+  cache = SD.open(name, EPD_CACHE_WRITE);
+  bool cache_ok = cache;
+  if (cache_ok)
+  {
+    //size the file first, the planes are then written band by band in
+    //whatever order the BMP holds its rows
+    uint8_t zeros[32];
+    memset(zeros, 0, sizeof(zeros));
+    cache_ok = (sizeof(header) == cache.write((const uint8_t *)&header, sizeof(header)));
+    for (uint16_t left = 2 * plane_bytes; cache_ok && (left != 0);)
+    {
+      uint8_t n = (left < sizeof(zeros)) ? left : sizeof(zeros);
+      cache_ok = (n == cache.write(zeros, n));
+      left -= n;
+    }
+  }
+
+  bool ok = loadBMP<BUS>(bmp, orientation, cache_ok ? &cache : 0, sizeof(header));
+  //loadBMP() closes the cache if writing to it fails
+  cache_ok = cache_ok && cache;
+  if (cache_ok && ok)
+  {
+    cache_ok = cache.seek(0) && (4 == cache.write((const uint8_t *)"EPD3", 4));
+  }
+  if (cache)
+  {
+    cache.close();
+  }
+  if (!(cache_ok && ok))
+  {
+    SD.remove(name);
+  }
+  return ok;
+}
+
+//=============================================================================
+#endif
@@ -0,0 +1,390 @@
+#ifndef __CONVERT_FOR_CFAP104212E00213_H__
+#define __CONVERT_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// 24-bit colour to 1bpp plane conversion
+//
+// Each pixel is read once and classified into both planes:
+//   * BW plane:     1 (black) when the luminance is 127 or less
+//   * Yellow plane: 1 when red > 228, green > 208 and blue < 250
+// Luminance is the .21/.72/.07 weighting in 8.8 fixed point. The weights sum
+// to 256 and the threshold is compared before the fraction is dropped, so the
+// result matches the floating point test except right at the boundary. The
+// AVR has an 8x8 hardware multiply, which is cheaper here than a PROGMEM
+// table lookup per channel.
+//
+// Photos and gradients fare badly with a hard threshold, so 24-bit input can
+// be dithered instead, see ditherBegin().
+//=============================================================================
+
+#define LUMA_R  (54)
+#define LUMA_G  (184)
+#define LUMA_B  (18)
+#define LUMA_THRESHOLD  (127)
+
+//Luminance in 8.8 fixed point, 0..65280
+static inline uint16_t luminance(uint8_t red, uint8_t green, uint8_t blue)
+{
+  return (uint16_t)LUMA_R * red + (uint16_t)LUMA_G * green + (uint16_t)LUMA_B * blue;
+}
+
+static inline uint8_t isDark(uint8_t red, uint8_t green, uint8_t blue)
+{
+  return luminance(red, green, blue) <= (LUMA_THRESHOLD << 8);
+}
+
+static inline uint8_t isYellow(uint8_t red, uint8_t green, uint8_t blue)
+{
+  return (228 < red) && (208 < green) && (blue < 250);
+}
+
+//=============================================================================
+// Dithering
+//
+// Each pixel is mapped to the nearest of white, black and yellow in a plane
+// of luminance l and yellowness c (luminance less blue, never below 0):
+// white is (255, 0), black (0, 0) and yellow (DITHER_YELLOW_L,
+// DITHER_YELLOW_L). Greys all have c = 0, so they never pick up yellow.
+//
+//   DITHER_BAYER      4x4 ordered dither, no memory
+//   DITHER_FLOYD      Floyd-Steinberg error diffusion
+//   DITHER_ATKINSON   Atkinson error diffusion, 3/4 of the error is passed
+//                     on so highlights and shadows stay clean
+//
+// Error diffusion works a row at a time in the order rows are converted; a
+// row may be converted in pieces (see convertPixels_BGR()). The error owed
+// to the next two rows is kept halved in int8_t, 4 bytes per pixel of the
+// widest (landscape) row, 848 bytes in all, so it is only built in when
+// EPD_DITHER_DIFFUSION is 1. Otherwise DITHER_FLOYD and DITHER_ATKINSON fall
+// back to DITHER_BAYER.
+#define DITHER_NONE     (0)
+#define DITHER_BAYER    (1)
+#define DITHER_FLOYD    (2)
+#define DITHER_ATKINSON (3)
+
+#ifndef EPD_DITHER_DIFFUSION
+#define EPD_DITHER_DIFFUSION (0)
+#endif
+
+//Luminance of the panel's yellow ink (about R 255, G 230, B 0)
+#define DITHER_YELLOW_L (219)
+
+//4x4 Bayer matrix, 0..15
+const uint8_t BAYER4[16] PROGMEM =
+{
+   0,  8,  2, 10,
+  12,  4, 14,  6,
+   3, 11,  1,  9,
+  15,  7, 13,  5
+};
+
+//Widest row converted, a rotated (landscape) image
+#define DITHER_MAX_WIDTH ((EPD_HRES < EPD_VRES) ? EPD_VRES : EPD_HRES)
+
+uint8_t dither_mode = DITHER_NONE;
+//rows started since ditherBegin()
+uint8_t dither_row = 0;
+
+//Nearest ink to luminance l, yellowness c (both 0..255): 0 white, 1 black,
+//2 yellow. The tests are the three perpendicular bisectors.
+static inline uint8_t nearestInk(int16_t l, int16_t c)
+{
+  bool white_over_black = 255 < 2 * l;
+  bool white_over_yellow = (int32_t)(255 * 255 - 2 * DITHER_YELLOW_L * DITHER_YELLOW_L) <
+                           (int32_t)(510 - 2 * DITHER_YELLOW_L) * l - (int32_t)(2 * DITHER_YELLOW_L) * c;
+  bool yellow_over_black = DITHER_YELLOW_L < l + c;
+  if (white_over_black && white_over_yellow)
+  {
+    return 0;
+  }
+  return yellow_over_black ? 2 : 1;
+}
+
+static inline int16_t clamp255(int16_t v)
+{
+  return (v < 0) ? 0 : ((255 < v) ? 255 : v);
+}
+
+#if EPD_DITHER_DIFFUSION
+static inline int8_t halveSaturate(int16_t v)
+{
+  v >>= 1;
+  return (v < -128) ? -128 : ((127 < v) ? 127 : v);
+}
+
+//Error carried along the row for one channel
+struct DitherCarry
+{
+  //owed to the next and the one after on this row
+  int16_t right;
+  int16_t right2;
+  //owed to x - 1 and x on the next row, not yet stored
+  int16_t below_left;
+  int16_t below;
+  //owed to x - 1 two rows down, not yet stored
+  int16_t far_left;
+};
+
+//Pass on error e of pixel x. Weights are in 16ths: Floyd-Steinberg 7 right,
+//3 5 1 below; Atkinson 2 to each of two right, three below and one two rows
+//down. near[x - 1] and far[x - 1] are final once x is done.
+static inline void diffuse(DitherCarry &c, int8_t *near, int8_t *far,
+                           uint8_t x, int16_t e, bool atkinson)
+{
+  int16_t below_left, below, below_right;
+  if (atkinson)
+  {
+    int16_t eighth = e >> 3;
+    c.right = c.right2 + eighth;
+    c.right2 = eighth;
+    below_left = eighth;
+    below = eighth;
+    below_right = eighth;
+  }
+  else
+  {
+    c.right = (e * 7) >> 4;
+    below_left = (e * 3) >> 4;
+    below = (e * 5) >> 4;
+    below_right = e >> 4;
+  }
+  if (x != 0)
+  {
+    near[x - 1] = halveSaturate(((int16_t)far[x - 1] << 1) + c.below_left + below_left);
+    far[x - 1] = halveSaturate(c.far_left);
+  }
+  c.below_left = c.below + below;
+  c.below = below_right;
+  c.far_left = atkinson ? (e >> 3) : 0;
+}
+
+//[0] is owed to the row being converted, becoming the next row as the
+//pixels pass; [1] is owed to the row after (Atkinson only)
+int8_t dither_error_l[2][DITHER_MAX_WIDTH];
+int8_t dither_error_c[2][DITHER_MAX_WIDTH];
+//carried between the pieces of a row
+DitherCarry dither_carry_l;
+DitherCarry dither_carry_c;
+//end of the row converted so far
+uint8_t dither_x;
+
+//Store what is still owed to the last pixel of the row on the next rows
+static void ditherEndRow(void)
+{
+  uint8_t x = dither_x;
+  if (x != 0)
+  {
+    dither_error_l[0][x - 1] = halveSaturate(((int16_t)dither_error_l[1][x - 1] << 1) + dither_carry_l.below_left);
+    dither_error_l[1][x - 1] = halveSaturate(dither_carry_l.far_left);
+    dither_error_c[0][x - 1] = halveSaturate(((int16_t)dither_error_c[1][x - 1] << 1) + dither_carry_c.below_left);
+    dither_error_c[1][x - 1] = halveSaturate(dither_carry_c.far_left);
+  }
+  memset(&dither_carry_l, 0, sizeof(dither_carry_l));
+  memset(&dither_carry_c, 0, sizeof(dither_carry_c));
+  dither_x = 0;
+}
+#endif
+
+//Pick the dither for the following rows and start a new image
+void ditherBegin(uint8_t mode)
+{
+  dither_mode = mode;
+  dither_row = 0;
+#if EPD_DITHER_DIFFUSION
+  memset(dither_error_l, 0, sizeof(dither_error_l));
+  memset(dither_error_c, 0, sizeof(dither_error_c));
+  memset(&dither_carry_l, 0, sizeof(dither_carry_l));
+  memset(&dither_carry_c, 0, sizeof(dither_carry_c));
+  dither_x = 0;
+#endif
+}
+
+//Dithered convertPixels_BGR(), same layout and overlay rules
+static void convertPixels_BGR_Dither(const uint8_t *bgr, uint16_t pixels,
+                                     uint8_t *bw, uint8_t *yellow, uint16_t x0)
+{
+#if EPD_DITHER_DIFFUSION
+  bool diffusing = (dither_mode == DITHER_FLOYD) || (dither_mode == DITHER_ATKINSON);
+  bool atkinson = (dither_mode == DITHER_ATKINSON);
+  DitherCarry &carry_l = dither_carry_l;
+  DitherCarry &carry_c = dither_carry_c;
+  if (x0 == 0)
+  {
+    ditherEndRow();
+  }
+#endif
+  if (x0 == 0)
+  {
+    dither_row++;
+  }
+  const uint8_t *bayer = &BAYER4[((dither_row - 1) & 3) << 2];
+  uint8_t x = x0;
+  while (pixels != 0)
+  {
+    uint8_t bw_byte = 0;
+    uint8_t y_byte = 0;
+    uint8_t n = (8 < pixels) ? 8 : pixels;
+    pixels -= n;
+    for (uint8_t i = 0; i < n; i++, x++)
+    {
+      int16_t l = luminance(bgr[2], bgr[1], bgr[0]) >> 8;
+      int16_t c = clamp255(l - bgr[0]);
+      bgr += 3;
+#if EPD_DITHER_DIFFUSION
+      if (diffusing)
+      {
+        l = clamp255(l + ((int16_t)dither_error_l[0][x] << 1) + carry_l.right);
+        c = clamp255(c + ((int16_t)dither_error_c[0][x] << 1) + carry_c.right);
+      }
+      else
+#endif
+      {
+        //threshold offsets -120..120, and 3/4 of that for c so greys
+        //stay clear of yellow
+        int16_t offset = ((int16_t)pgm_read_byte(&bayer[x & 3]) << 4) - 120;
+        l = clamp255(l + offset);
+        c = clamp255(c + ((offset * 3) >> 2));
+      }
+      uint8_t ink = nearestInk(l, c);
+      bw_byte = (bw_byte << 1) | (ink == 1);
+      y_byte = (y_byte << 1) | (ink == 2);
+#if EPD_DITHER_DIFFUSION
+      if (diffusing)
+      {
+        diffuse(carry_l, dither_error_l[0], dither_error_l[1], x,
+                l - ((ink == 0) ? 255 : ((ink == 2) ? DITHER_YELLOW_L : 0)), atkinson);
+        diffuse(carry_c, dither_error_c[0], dither_error_c[1], x,
+                c - ((ink == 2) ? DITHER_YELLOW_L : 0), atkinson);
+      }
+#endif
+    }
+    bw_byte <<= 8 - n;
+    y_byte <<= 8 - n;
+    *bw++ = bw_byte;
+    *yellow++ = y_byte;
+  }
+#if EPD_DITHER_DIFFUSION
+  //the end of the row is settled when the next one starts
+  dither_x = diffusing ? x : 0;
+#endif
+}
+
+//Convert pixels of B,G,R triplets (BMP order) into (pixels + 7) / 8 bytes of
+//each plane. The last byte is padded with white. Output byte n is written
+//only after input byte 24 * n + 23 has been read, so the planes may overlay
+//the front of the input: bw = bgr, yellow = bgr + (pixels + 7) / 8 is safe
+//for lines up to 184 pixels.
+//
+//A long row can be converted in pieces, x0 being the first pixel's column
+//(a multiple of 8); the dither carries on from the previous piece unless x0
+//is 0.
+void convertPixels_BGR(const uint8_t *bgr, uint16_t pixels,
+                       uint8_t *bw, uint8_t *yellow, uint16_t x0)
+{
+  if (dither_mode != DITHER_NONE)
+  {
+    convertPixels_BGR_Dither(bgr, pixels, bw, yellow, x0);
+    return;
+  }
+  while (pixels != 0)
+  {
+    uint8_t bw_byte = 0;
+    uint8_t y_byte = 0;
+    uint8_t n = (8 < pixels) ? 8 : pixels;
+    pixels -= n;
+    for (uint8_t i = 0; i < n; i++)
+    {
+      uint8_t blue = bgr[0];
+      uint8_t green = bgr[1];
+      uint8_t red = bgr[2];
+      bgr += 3;
+      bw_byte <<= 1;
+      y_byte <<= 1;
+      if (isDark(red, green, blue))
+      {
+        bw_byte |= 0x01;
+      }
+      if (isYellow(red, green, blue))
+      {
+        y_byte |= 0x01;
+      }
+    }
+    //left justify a short final byte
+    bw_byte <<= 8 - n;
+    y_byte <<= 8 - n;
+    *bw++ = bw_byte;
+    *yellow++ = y_byte;
+  }
+}
+
+//=============================================================================
+// Indexed colour (1 and 8 bits per pixel)
+//
+// Rather than keep a 1 KB palette, each palette entry is classified once as
+// it is read and kept as 2 bits: bit 0 dark, bit 1 yellow. 256 entries fit
+// in 64 bytes.
+#define PALETTE_DARK    (0x01)
+#define PALETTE_YELLOW  (0x02)
+
+static inline void setPaletteClass(uint8_t *classes, uint8_t index,
+                                   uint8_t red, uint8_t green, uint8_t blue)
+{
+  uint8_t shift = (index & 3) << 1;
+  uint8_t c = (isDark(red, green, blue) ? PALETTE_DARK : 0) |
+              (isYellow(red, green, blue) ? PALETTE_YELLOW : 0);
+  classes[index >> 2] = (classes[index >> 2] & ~(0x03 << shift)) | (c << shift);
+}
+
+static inline uint8_t paletteClass(const uint8_t *classes, uint8_t index)
+{
+  return (classes[index >> 2] >> ((index & 3) << 1)) & 0x03;
+}
+
+//Convert pixels of 1 or 8 bit palette indices into both planes. Unlike
+//convertPixels_BGR(), the planes must not overlap the input.
+void convertPixels_Indexed(const uint8_t *row, uint16_t pixels, uint8_t bpp,
+                           const uint8_t *classes, uint8_t *bw, uint8_t *yellow)
+{
+  uint8_t bits = 0;
+  uint8_t shift = 0;
+  while (pixels != 0)
+  {
+    uint8_t bw_byte = 0;
+    uint8_t y_byte = 0;
+    uint8_t n = (8 < pixels) ? 8 : pixels;
+    pixels -= n;
+    for (uint8_t i = 0; i < n; i++)
+    {
+      uint8_t index;
+      if (bpp == 8)
+      {
+        index = *row++;
+      }
+      else
+      {
+        if (shift == 0)
+        {
+          bits = *row++;
+          shift = 8;
+        }
+        shift--;
+        index = (bits >> shift) & 0x01;
+      }
+      uint8_t c = paletteClass(classes, index);
+      bw_byte = (bw_byte << 1) | (c & PALETTE_DARK);
+      y_byte = (y_byte << 1) | ((c & PALETTE_YELLOW) >> 1);
+    }
+    bw_byte <<= 8 - n;
+    y_byte <<= 8 - n;
+    *bw++ = bw_byte;
+    *yellow++ = y_byte;
+  }
+}
+
+//=============================================================================
+#endif
@@ -0,0 +1,260 @@
+#ifndef __FONTS_FOR_CFAP104212E00213_H__
+#define __FONTS_FOR_CFAP104212E00213_H__
+//=============================================================================
+// Fonts for Text_for_CFAP104212E00213.h, written by tools/make_fonts.py
+//
+//   Font_Small   8 rows, all of printable ASCII
+//   Font_Large  16 rows, space to ':' (digits, + - . / % :), twice size
+//=============================================================================
+
+//752 bytes of glyphs, 380 of index
+const uint8_t Font_Small_Bitmap[752] PROGMEM =
+{ 0x80,0x80,0x80,0x80,0x80,0x00,0x80,0x00,0xA0,0xA0,0xA0,0x00,0x00,
+0x00,0x00,0x00,0x50,0x50,0xF8,0x50,0xF8,0x50,0x50,0x00,0x20,0x78,
+0xA0,0x70,0x28,0xF0,0x20,0x00,0xC0,0xC8,0x10,0x20,0x40,0x98,0x18,
+0x00,0x40,0xA0,0xA0,0x40,0xA8,0x90,0x68,0x00,0x60,0x60,0x40,0x80,
+0x00,0x00,0x00,0x00,0x20,0x40,0x80,0x80,0x80,0x40,0x20,0x00,0x80,
+0x40,0x20,0x20,0x20,0x40,0x80,0x00,0x20,0xA8,0x70,0xF8,0x70,0xA8,
+0x20,0x00,0x00,0x20,0x20,0xF8,0x20,0x20,0x00,0x00,0x00,0x00,0x00,
+0x00,0x60,0x60,0x40,0x80,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0x08,0x10,0x20,0x40,
+0x80,0x00,0x00,0x70,0x88,0x98,0xA8,0xC8,0x88,0x70,0x00,0x20,0x60,
+0x20,0x20,0x20,0x20,0x70,0x00,0x70,0x88,0x08,0x70,0x80,0x80,0xF8,
+0x00,0xF8,0x08,0x10,0x30,0x08,0x88,0x70,0x00,0x10,0x30,0x50,0x90,
+0xF8,0x10,0x10,0x00,0xF8,0x80,0xF0,0x08,0x08,0x88,0x70,0x00,0x38,
+0x40,0x80,0xF0,0x88,0x88,0x70,0x00,0xF8,0x08,0x08,0x10,0x20,0x40,
+0x80,0x00,0x70,0x88,0x88,0x70,0x88,0x88,0x70,0x00,0x70,0x88,0x88,
+0x78,0x08,0x10,0xE0,0x00,0x00,0x00,0x80,0x00,0x80,0x00,0x00,0x00,
+0x00,0x00,0x40,0x00,0x40,0x40,0x80,0x00,0x10,0x20,0x40,0x80,0x40,
+0x20,0x10,0x00,0x00,0x00,0xF8,0x00,0xF8,0x00,0x00,0x00,0x80,0x40,
+0x20,0x10,0x20,0x40,0x80,0x00,0x70,0x88,0x08,0x30,0x20,0x00,0x20,
+0x00,0x70,0x88,0xA8,0xB8,0xB0,0x80,0x78,0x00,0x20,0x50,0x88,0x88,
+0xF8,0x88,0x88,0x00,0xF0,0x88,0x88,0xF0,0x88,0x88,0xF0,0x00,0x70,
+0x88,0x80,0x80,0x80,0x88,0x70,0x00,0xF0,0x88,0x88,0x88,0x88,0x88,
+0xF0,0x00,0xF8,0x80,0x80,0xF0,0x80,0x80,0xF8,0x00,0xF8,0x80,0x80,
+0xF0,0x80,0x80,0x80,0x00,0x78,0x88,0x80,0x80,0x98,0x88,0x78,0x00,
+0x88,0x88,0x88,0xF8,0x88,0x88,0x88,0x00,0xE0,0x40,0x40,0x40,0x40,
+0x40,0xE0,0x00,0x38,0x10,0x10,0x10,0x10,0x90,0x60,0x00,0x88,0x90,
+0xA0,0xC0,0xA0,0x90,0x88,0x00,0x80,0x80,0x80,0x80,0x80,0x80,0xF8,
+0x00,0x88,0xD8,0xA8,0xA8,0xA8,0x88,0x88,0x00,0x88,0x88,0xC8,0xA8,
+0x98,0x88,0x88,0x00,0x70,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0xF0,
+0x88,0x88,0xF0,0x80,0x80,0x80,0x00,0x70,0x88,0x88,0x88,0xA8,0x90,
+0x68,0x00,0xF0,0x88,0x88,0xF0,0xA0,0x90,0x88,0x00,0x70,0x88,0x80,
+0x70,0x08,0x88,0x70,0x00,0xF8,0xA8,0x20,0x20,0x20,0x20,0x20,0x00,
+0x88,0x88,0x88,0x88,0x88,0x88,0x70,0x00,0x88,0x88,0x88,0x88,0x88,
+0x50,0x20,0x00,0x88,0x88,0x88,0xA8,0xA8,0xA8,0x50,0x00,0x88,0x88,
+0x50,0x20,0x50,0x88,0x88,0x00,0x88,0x88,0x50,0x20,0x20,0x20,0x20,
+0x00,0xF8,0x08,0x10,0x70,0x40,0x80,0xF8,0x00,0xF0,0x80,0x80,0x80,
+0x80,0x80,0xF0,0x00,0x00,0x80,0x40,0x20,0x10,0x08,0x00,0x00,0xF0,
+0x10,0x10,0x10,0x10,0x10,0xF0,0x00,0x20,0x50,0x88,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0xC0,0xC0,0x40,
+0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x10,0x70,0x90,0x78,0x00,
+0x80,0x80,0xB0,0xC8,0x88,0xC8,0xB0,0x00,0x00,0x00,0x70,0x88,0x80,
+0x88,0x70,0x00,0x08,0x08,0x68,0x98,0x88,0x98,0x68,0x00,0x00,0x00,
+0x70,0x88,0xF8,0x80,0x70,0x00,0x20,0x50,0x40,0xE0,0x40,0x40,0x40,
+0x00,0x00,0x00,0x70,0x98,0x98,0x68,0x08,0x70,0x80,0x80,0xB0,0xC8,
+0x88,0x88,0x88,0x00,0x40,0x00,0xC0,0x40,0x40,0x40,0xE0,0x00,0x10,
+0x00,0x10,0x10,0x10,0x90,0x60,0x00,0x80,0x80,0x90,0xA0,0xC0,0xA0,
+0x90,0x00,0xC0,0x40,0x40,0x40,0x40,0x40,0xE0,0x00,0x00,0x00,0xD0,
+0xA8,0xA8,0xA8,0xA8,0x00,0x00,0x00,0xB0,0xC8,0x88,0x88,0x88,0x00,
+0x00,0x00,0x70,0x88,0x88,0x88,0x70,0x00,0x00,0x00,0xB0,0xC8,0xC8,
+0xB0,0x80,0x80,0x00,0x00,0x68,0x98,0x98,0x68,0x08,0x08,0x00,0x00,
+0xB0,0xC8,0x80,0x80,0x80,0x00,0x00,0x00,0x78,0x80,0x70,0x08,0xF0,
+0x00,0x20,0x20,0xF8,0x20,0x20,0x28,0x10,0x00,0x00,0x00,0x88,0x88,
+0x88,0x98,0x68,0x00,0x00,0x00,0x88,0x88,0x88,0x50,0x20,0x00,0x00,
+0x00,0x88,0x88,0xA8,0xA8,0x50,0x00,0x00,0x00,0x88,0x50,0x20,0x50,
+0x88,0x00,0x00,0x00,0x88,0x88,0x78,0x08,0x88,0x70,0x00,0x00,0xF8,
+0x10,0x20,0x40,0xF8,0x00,0x20,0x40,0x40,0x80,0x40,0x40,0x20,0x00,
+0x80,0x80,0x80,0x00,0x80,0x80,0x80,0x00,0x80,0x40,0x40,0x20,0x40,
+0x40,0x80,0x00,0x40,0xA8,0x10,0x00,0x00,0x00,0x00,0x00 };
+const EPD_Glyph Font_Small_Glyphs[95] PROGMEM =
+{
+  {    0,  0,  3 }, //' '
+  {    0,  1,  2 }, //'!'
+  {    8,  3,  4 }, //'"'
+  {   16,  5,  6 }, //'#'
+  {   24,  5,  6 }, //'$'
+  {   32,  5,  6 }, //'%'
+  {   40,  5,  6 }, //'&'
+  {   48,  3,  4 }, //'''
+  {   56,  3,  4 }, //'('
+  {   64,  3,  4 }, //')'
+  {   72,  5,  6 }, //'*'
+  {   80,  5,  6 }, //'+'
+  {   88,  3,  4 }, //','
+  {   96,  5,  6 }, //'-'
+  {  104,  2,  3 }, //'.'
+  {  112,  5,  6 }, //'/'
+  {  120,  5,  6 }, //'0'
+  {  128,  5,  6 }, //'1'
+  {  136,  5,  6 }, //'2'
+  {  144,  5,  6 }, //'3'
+  {  152,  5,  6 }, //'4'
+  {  160,  5,  6 }, //'5'
+  {  168,  5,  6 }, //'6'
+  {  176,  5,  6 }, //'7'
+  {  184,  5,  6 }, //'8'
+  {  192,  5,  6 }, //'9'
+  {  200,  1,  2 }, //':'
+  {  208,  2,  3 }, //';'
+  {  216,  4,  5 }, //'<'
+  {  224,  5,  6 }, //'='
+  {  232,  4,  5 }, //'>'
+  {  240,  5,  6 }, //'?'
+  {  248,  5,  6 }, //'@'
+  {  256,  5,  6 }, //'A'
+  {  264,  5,  6 }, //'B'
+  {  272,  5,  6 }, //'C'
+  {  280,  5,  6 }, //'D'
+  {  288,  5,  6 }, //'E'
+  {  296,  5,  6 }, //'F'
+  {  304,  5,  6 }, //'G'
+  {  312,  5,  6 }, //'H'
+  {  320,  3,  4 }, //'I'
+  {  328,  5,  6 }, //'J'
+  {  336,  5,  6 }, //'K'
+  {  344,  5,  6 }, //'L'
+  {  352,  5,  6 }, //'M'
+  {  360,  5,  6 }, //'N'
+  {  368,  5,  6 }, //'O'
+  {  376,  5,  6 }, //'P'
+  {  384,  5,  6 }, //'Q'
+  {  392,  5,  6 }, //'R'
+  {  400,  5,  6 }, //'S'
+  {  408,  5,  6 }, //'T'
+  {  416,  5,  6 }, //'U'
+  {  424,  5,  6 }, //'V'
+  {  432,  5,  6 }, //'W'
+  {  440,  5,  6 }, //'X'
+  {  448,  5,  6 }, //'Y'
+  {  456,  5,  6 }, //'Z'
+  {  464,  4,  5 }, //'['
+  {  472,  5,  6 }, //backslash
+  {  480,  4,  5 }, //']'
+  {  488,  5,  6 }, //'^'
+  {  496,  5,  6 }, //'_'
+  {  504,  3,  4 }, //'`'
+  {  512,  5,  6 }, //'a'
+  {  520,  5,  6 }, //'b'
+  {  528,  5,  6 }, //'c'
+  {  536,  5,  6 }, //'d'
+  {  544,  5,  6 }, //'e'
+  {  552,  4,  5 }, //'f'
+  {  560,  5,  6 }, //'g'
+  {  568,  5,  6 }, //'h'
+  {  576,  3,  4 }, //'i'
+  {  584,  4,  5 }, //'j'
+  {  592,  4,  5 }, //'k'
+  {  600,  3,  4 }, //'l'
+  {  608,  5,  6 }, //'m'
+  {  616,  5,  6 }, //'n'
+  {  624,  5,  6 }, //'o'
+  {  632,  5,  6 }, //'p'
+  {  640,  5,  6 }, //'q'
+  {  648,  5,  6 }, //'r'
+  {  656,  5,  6 }, //'s'
+  {  664,  5,  6 }, //'t'
+  {  672,  5,  6 }, //'u'
+  {  680,  5,  6 }, //'v'
+  {  688,  5,  6 }, //'w'
+  {  696,  5,  6 }, //'x'
+  {  704,  5,  6 }, //'y'
+  {  712,  5,  6 }, //'z'
+  {  720,  3,  4 }, //'{'
+  {  728,  1,  2 }, //'|'
+  {  736,  3,  4 }, //'}'
+  {  744,  5,  6 }, //'~'
+};
+const EPD_Font Font_Small = { Font_Small_Bitmap, Font_Small_Glyphs, 0x20, 0x7E, 8 };
+
+//704 bytes of glyphs, 108 of index
+const uint8_t Font_Large_Bitmap[704] PROGMEM =
+{ 0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x00,0x00,0xC0,
+0xC0,0x00,0x00,0xCC,0xCC,0xCC,0xCC,0xCC,0xCC,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x33,
+0x00,0xFF,0xC0,0xFF,0xC0,0x33,0x00,0x33,0x00,0xFF,0xC0,0xFF,0xC0,
+0x33,0x00,0x33,0x00,0x33,0x00,0x33,0x00,0x00,0x00,0x00,0x00,0x0C,
+0x00,0x0C,0x00,0x3F,0xC0,0x3F,0xC0,0xCC,0x00,0xCC,0x00,0x3F,0x00,
+0x3F,0x00,0x0C,0xC0,0x0C,0xC0,0xFF,0x00,0xFF,0x00,0x0C,0x00,0x0C,
+0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0xF0,0x00,0xF0,0xC0,0xF0,0xC0,
+0x03,0x00,0x03,0x00,0x0C,0x00,0x0C,0x00,0x30,0x00,0x30,0x00,0xC3,
+0xC0,0xC3,0xC0,0x03,0xC0,0x03,0xC0,0x00,0x00,0x00,0x00,0x30,0x00,
+0x30,0x00,0xCC,0x00,0xCC,0x00,0xCC,0x00,0xCC,0x00,0x30,0x00,0x30,
+0x00,0xCC,0xC0,0xCC,0xC0,0xC3,0x00,0xC3,0x00,0x3C,0xC0,0x3C,0xC0,
+0x00,0x00,0x00,0x00,0x3C,0x3C,0x3C,0x3C,0x30,0x30,0xC0,0xC0,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x0C,0x30,0x30,0xC0,0xC0,
+0xC0,0xC0,0xC0,0xC0,0x30,0x30,0x0C,0x0C,0x00,0x00,0xC0,0xC0,0x30,
+0x30,0x0C,0x0C,0x0C,0x0C,0x0C,0x0C,0x30,0x30,0xC0,0xC0,0x00,0x00,
+0x0C,0x00,0x0C,0x00,0xCC,0xC0,0xCC,0xC0,0x3F,0x00,0x3F,0x00,0xFF,
+0xC0,0xFF,0xC0,0x3F,0x00,0x3F,0x00,0xCC,0xC0,0xCC,0xC0,0x0C,0x00,
+0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,
+0x00,0x0C,0x00,0x0C,0x00,0xFF,0xC0,0xFF,0xC0,0x0C,0x00,0x0C,0x00,
+0x0C,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x3C,0x3C,0x3C,0x30,0x30,
+0xC0,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0xFF,0xC0,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0xF0,0xF0,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0xC0,0x00,0xC0,0x03,0x00,0x03,0x00,0x0C,0x00,0x0C,
+0x00,0x30,0x00,0x30,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC3,
+0xC0,0xC3,0xC0,0xCC,0xC0,0xCC,0xC0,0xF0,0xC0,0xF0,0xC0,0xC0,0xC0,
+0xC0,0xC0,0x3F,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x0C,
+0x00,0x3C,0x00,0x3C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,
+0x0C,0x00,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x3F,0x00,0x3F,0x00,0x00,
+0x00,0x00,0x00,0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0x00,0xC0,
+0x00,0xC0,0x3F,0x00,0x3F,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,
+0x00,0xFF,0xC0,0xFF,0xC0,0x00,0x00,0x00,0x00,0xFF,0xC0,0xFF,0xC0,
+0x00,0xC0,0x00,0xC0,0x03,0x00,0x03,0x00,0x0F,0x00,0x0F,0x00,0x00,
+0xC0,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0x00,0x00,
+0x00,0x00,0x03,0x00,0x03,0x00,0x0F,0x00,0x0F,0x00,0x33,0x00,0x33,
+0x00,0xC3,0x00,0xC3,0x00,0xFF,0xC0,0xFF,0xC0,0x03,0x00,0x03,0x00,
+0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,0xFF,0xC0,0xC0,
+0x00,0xC0,0x00,0xFF,0x00,0xFF,0x00,0x00,0xC0,0x00,0xC0,0x00,0xC0,
+0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,0x3F,0x00,0x00,0x00,0x00,
+0x00,0x0F,0xC0,0x0F,0xC0,0x30,0x00,0x30,0x00,0xC0,0x00,0xC0,0x00,
+0xFF,0x00,0xFF,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,
+0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0xFF,0xC0,0xFF,0xC0,0x00,0xC0,
+0x00,0xC0,0x00,0xC0,0x00,0xC0,0x03,0x00,0x03,0x00,0x0C,0x00,0x0C,
+0x00,0x30,0x00,0x30,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,
+0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,
+0x00,0x3F,0x00,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0x00,
+0x3F,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x3F,0x00,0xC0,0xC0,0xC0,
+0xC0,0xC0,0xC0,0xC0,0xC0,0x3F,0xC0,0x3F,0xC0,0x00,0xC0,0x00,0xC0,
+0x03,0x00,0x03,0x00,0xFC,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0xC0,0xC0,0x00,0x00,0xC0,0xC0,0x00,0x00,0x00,0x00,
+0x00,0x00 };
+const EPD_Glyph Font_Large_Glyphs[27] PROGMEM =
+{
+  {    0,  0,  6 }, //' '
+  {    0,  2,  4 }, //'!'
+  {   16,  6,  8 }, //'"'
+  {   32, 10, 12 }, //'#'
+  {   64, 10, 12 }, //'$'
+  {   96, 10, 12 }, //'%'
+  {  128, 10, 12 }, //'&'
+  {  160,  6,  8 }, //'''
+  {  176,  6,  8 }, //'('
+  {  192,  6,  8 }, //')'
+  {  208, 10, 12 }, //'*'
+  {  240, 10, 12 }, //'+'
+  {  272,  6,  8 }, //','
+  {  288, 10, 12 }, //'-'
+  {  320,  4,  6 }, //'.'
+  {  336, 10, 12 }, //'/'
+  {  368, 10, 12 }, //'0'
+  {  400, 10, 12 }, //'1'
+  {  432, 10, 12 }, //'2'
+  {  464, 10, 12 }, //'3'
+  {  496, 10, 12 }, //'4'
+  {  528, 10, 12 }, //'5'
+  {  560, 10, 12 }, //'6'
+  {  592, 10, 12 }, //'7'
+  {  624, 10, 12 }, //'8'
+  {  656, 10, 12 }, //'9'
+  {  688,  2,  4 }, //':'
+};
+const EPD_Font Font_Large = { Font_Large_Bitmap, Font_Large_Glyphs, 0x20, 0x3A, 16 };
+
+//=============================================================================
+#endif
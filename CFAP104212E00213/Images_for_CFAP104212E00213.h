@@ -12,432 +12,215 @@
 #define WIDTH_PIXELS     (104)
 #define WIDTH_MONO_BYTES (13)
 
-const uint8_t Splash_Yellow_1BPP[2756] PROGMEM =
-{ 0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x7F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFE,0x7F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFC,0x7F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xF8,0x3F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xF0,0x7F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xE1,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xC3,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x87,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x3F,0xFE,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x1F,0xFE,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x1F,0xFC,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x1F,0xF0,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x0F,0x80,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xC0,0x07,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF8,0x03,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0x01,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xF1,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x01,0xFE,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x01,0xE0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x01,0xC0,0x3C,0x3F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x83,0x3E,0x1F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x87,0x1F,0x1F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x1F,0x9F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x9F,0x9F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x8F,0x9F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x8F,0x9F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xCF,0x1F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xC6,0x1F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xC4,0x3F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC0,0x3F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x7F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE1,0xFF,0xF7,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x67,0xFF,0xC7,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x7F,0xFE,0x03,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xE0,0x03,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0x00,0x1F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xF8,0x00,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC0,0x0F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x7F,0xFD,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xF1,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0x80,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xF8,0x00,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xC0,0x07,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFE,0x00,0x3F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x03,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x1F,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x80,0x7F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x3F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x1F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x3F,0x0F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xFF,0x87,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x23,0xFF,0xC7,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xE7,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xE7,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xE7,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xE7,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xC7,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x87,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0x0F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFC,0x0F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x01,0xFC,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x9F,0xF8,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xE0,0x7F,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xC1,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x03,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFE,0x0F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFC,0x1F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x7F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x1F,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFC,0x0F,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xF8,0x3F,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xE0,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xC1,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x07,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x0F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x3F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0xFF,0xFF,0xFF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xC7,0xDC,0x7F,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0xBB,0x9B,0xBF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xFB,0x5F,0xBF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0xF7,0xDE,0x7F,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xEF,0xDF,0xBF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xDF,0xDB,0xBF,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x83,0xDC,0x7F,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xFF,0xFF,0xFF };
+//Planes packed by tools/pack_images.py, see Packed_for_CFAP104212E00213.h
 
-const uint8_t Splash_Mono_1BPP[2756] PROGMEM =
-{ 0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFD,0xFF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xF8,0xFC,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xF2,0x38,0x9F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xC7,0x33,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0x8F,0xE7,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0x1F,0x87,0xE1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFE,0x1F,0x07,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFE,0x1F,0x07,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFE,0x1F,0x07,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x04,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x06,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x04,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x04,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x06,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x04,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xC0,0x01,0x04,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xE0,0x01,0x04,0x00,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFE,0x1F,0x07,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFE,0x1F,0x07,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFE,0x1F,0x87,0xE0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0x1F,0xC7,0xE1,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0x8F,0xE3,0xE7,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xE7,0x31,0xCF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xF0,0x78,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xF8,0xFE,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x1F,0xFF,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xFD,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x1F,0xF1,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0xE3,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x8F,0xE3,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x87,0xE3,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC7,0xC7,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC3,0xC7,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x8F,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0x8F,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x03,0xE1,0x8F,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x01,0xF1,0x07,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0xF0,0x01,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0xF8,0x78,0x20,0xFF,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE1,0xFB,0xF8,0x30,0x3F,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xFF,0xFC,0x7C,0x0F,0xFF,
-0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE3,0xFF,0xFC,0x7E,0x07,0xFE,
-0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0x9F,0xE3,0xFF,0xFC,0x3F,0x81,0xF8,
-0xFF,0xFF,0xFF,0xF8,0xFF,0xFC,0x07,0xC3,0xFF,0xFE,0x3F,0xC3,0xC0,
-0xFF,0xFF,0xFF,0xF8,0x7F,0xF0,0x03,0xE3,0xFF,0xCE,0x1F,0xEF,0x00,
-0xFF,0xFF,0xFF,0xFC,0x7F,0xE0,0xC1,0xE3,0xFF,0x8F,0x1F,0xFC,0x00,
-0xFF,0xFF,0xFF,0xFC,0x3F,0xC3,0xE1,0xE1,0xFF,0x8F,0x0F,0xE0,0x00,
-0xFF,0xFF,0xFF,0xFE,0x3F,0x8F,0xF1,0xE1,0xFF,0x8F,0x8F,0x80,0x00,
-0xFF,0xFF,0xE3,0xFE,0x1F,0x0F,0xF0,0xF0,0xFF,0x8F,0xBE,0x00,0x00,
-0xFF,0xFF,0x00,0xFF,0x1F,0x1F,0xE0,0xF0,0xFF,0x1F,0xF8,0x00,0x00,
-0xFF,0xFC,0x00,0x7F,0x1F,0x1F,0xC0,0x78,0x7E,0x1F,0xC0,0x00,0x00,
-0xFF,0xF0,0x00,0x3F,0x0F,0x3F,0x04,0x7C,0x18,0x3F,0x00,0x00,0x00,
-0xFF,0x80,0x7E,0x1F,0x8F,0xFC,0x1C,0x3E,0x00,0x7C,0x00,0x00,0x00,
-0xFE,0x01,0xFE,0x1F,0x87,0xF8,0x3C,0x3F,0x01,0xE0,0x00,0x00,0x00,
-0xFF,0x0F,0xFF,0x1F,0xC7,0xF0,0xFE,0x1F,0xFF,0x80,0x00,0x00,0x00,
-0xFF,0x0F,0xFF,0x1F,0xC3,0xE1,0xFE,0x1F,0xFE,0x00,0x00,0x00,0x00,
-0xFF,0x8F,0xFF,0x1F,0xE3,0xE3,0xFC,0x0F,0xF0,0x00,0x00,0x00,0x00,
-0xFF,0x87,0xFE,0x3F,0xE3,0xE3,0xFC,0x87,0xC0,0x00,0x00,0x00,0x00,
-0xFF,0x87,0xFC,0x3F,0xE1,0xE3,0xF8,0x9F,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xC3,0xF0,0x03,0xF1,0xE1,0xF1,0xFC,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xC3,0xC0,0x01,0xF0,0xF0,0x03,0xE0,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xE3,0x00,0xE0,0xF8,0xF0,0x07,0x81,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xE0,0x07,0xF0,0xF8,0x78,0x1E,0x01,0x80,0x00,0x00,0x00,0x00,
-0xFF,0xF0,0x1F,0xF8,0x7C,0x7F,0xF0,0x01,0x80,0x00,0x00,0x00,0x00,
-0xFF,0xF0,0xFF,0xF8,0x7C,0x7F,0xC0,0x03,0x80,0x00,0x00,0x00,0x00,
-0xFF,0xF0,0xFF,0xF8,0x7C,0x3F,0x00,0x07,0xC0,0x00,0x00,0x00,0x00,
-0xFF,0xF8,0x7F,0xF8,0x7E,0xFC,0x00,0x0F,0x80,0x00,0x00,0x00,0x00,
-0xFF,0xF8,0x7F,0xF8,0x7F,0xE0,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFC,0x7F,0xF0,0xFF,0x80,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFC,0x3F,0xE0,0xFE,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFE,0x3F,0x81,0xF0,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFE,0x1C,0x07,0xC0,0x00,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0x10,0x0F,0x00,0x00,0x01,0xF0,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0x00,0x7C,0x00,0x00,0x01,0xE0,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0x01,0xE0,0x00,0x00,0x03,0xC0,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0x87,0x80,0x00,0x00,0x0F,0x80,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0x9E,0x00,0x00,0x00,0x7F,0xC0,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xF0,0x00,0x18,0x03,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0xC0,0x01,0x1F,0x1F,0xFD,0xFF,0x80,0x00,0x00,0x00,0x00,
-0xFF,0xFF,0x00,0x07,0x1F,0x9F,0xE0,0x3F,0xF8,0x00,0x00,0x00,0x00,
-0xFF,0xFC,0x00,0x1F,0x9F,0xCF,0x00,0x07,0xFC,0x00,0x00,0x00,0x00,
-0xFF,0xE0,0x00,0x3F,0x81,0xC8,0x00,0x00,0xFE,0x00,0x00,0x00,0x00,
-0xFF,0x80,0x00,0x7D,0x80,0xE0,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,
-0xFE,0x00,0x00,0x79,0xC0,0xE0,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
-0xF0,0x00,0x00,0x71,0xC0,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0xC0,0x00,0x00,0xE0,0xC0,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xE0,0xE0,0x70,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xE0,0xE0,0x70,0x07,0xFF,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0xE0,0x60,0xE0,0x1F,0xFF,0x80,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x60,0x71,0xE0,0x3F,0xC3,0xC0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x70,0x73,0xE0,0x7C,0xC1,0xE0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x78,0x3F,0xC0,0x78,0xE0,0xE0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x3F,0xFF,0x80,0xF0,0xE0,0x60,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x1F,0xFF,0x04,0xE0,0x60,0x60,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x0F,0xFC,0x1E,0xE0,0x70,0x60,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xC0,0x0E,0xE0,0x70,0x60,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x0E,0xE0,0x30,0xE0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x1E,0x60,0x39,0xE0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0xFE,0x70,0x3B,0xC0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x0E,0x03,0xFC,0x78,0x3F,0xC0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x06,0x1F,0xF0,0x3F,0x1F,0x80,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x07,0xFF,0x80,0x1F,0x1E,0x00,0x08,0x00,0x00,0x00,
-0x00,0x00,0x00,0x07,0xFE,0x00,0x0F,0x98,0x00,0x38,0x00,0x00,0x00,
-0x00,0x00,0x00,0x3F,0xF0,0x00,0x03,0x80,0x01,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x01,0xFF,0x80,0x01,0x80,0x00,0x1F,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0xFF,0x80,0x0F,0xC0,0x00,0xFF,0xE0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x21,0x80,0x7F,0xC0,0x07,0xFF,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x02,0x03,0xFF,0x00,0x3F,0xF0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1F,0xF8,0x01,0xFF,0x80,0x02,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x7F,0xC0,0x07,0xFC,0x00,0x0E,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xFE,0x00,0x27,0xE0,0x00,0x7F,0x00,0x00,0x00,
-0x00,0x00,0x00,0x10,0xF0,0x00,0xF7,0x00,0x07,0xFF,0x00,0x00,0x00,
-0x00,0x00,0x00,0x78,0xC0,0x07,0xF0,0x00,0x3F,0xF8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x78,0x00,0x3F,0xF0,0x01,0xFF,0xC0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x30,0x01,0xFF,0x80,0x0F,0xFC,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x07,0xFC,0x00,0x7F,0xE0,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0F,0xE0,0x01,0xFF,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1F,0x00,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1E,0x00,0x01,0xC0,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x00,0x7F,0x80,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x03,0xFF,0xC0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x07,0xFF,0xE0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1C,0x00,0x06,0x0F,0xC0,0xF0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0E,0x00,0x3F,0x1F,0x00,0x78,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0E,0x01,0xFF,0x1C,0x00,0x38,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x07,0x8F,0xFC,0x3C,0x00,0x18,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x03,0xFF,0xE0,0x38,0x00,0x18,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x01,0xFF,0x00,0x38,0x00,0x18,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x0F,0xF8,0x00,0x38,0x00,0x18,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x7F,0xE0,0x00,0x38,0x00,0x38,0x00,0x00,0x00,
-0x00,0x00,0x00,0x01,0xFF,0x00,0x00,0x18,0x00,0x78,0x00,0x00,0x00,
-0x00,0x00,0x00,0x01,0xF8,0x00,0x00,0x1C,0x00,0xF0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x1E,0x03,0xF0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xE0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFF,0x80,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xFE,0x03,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xF0,0x60,0x07,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x07,0xFF,0xFF,0xF8,0x00,0x1F,0x80,0x00,0x00,
-0x00,0x00,0x00,0x00,0x3F,0xFF,0xFF,0xF8,0x00,0x3E,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x3F,0xFF,0xC0,0xF8,0x00,0xFC,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x1F,0x00,0x03,0xE0,0x01,0xF0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC0,0x03,0xE0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x0F,0x80,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x1F,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x7C,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x00,0xF8,0x1F,0xE0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0xFF,0xFF,0xE0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x0F,0x80,0x00,0xFF,0xFF,0xF0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x60,0x03,0xF0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x00,0x07,0xC0,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x03,0xE0,0x01,0xFF,0xC0,0x3E,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xC0,0xF8,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x01,0xFF,0xFF,0xFF,0xC3,0xF0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x01,0xFF,0xF8,0x07,0xE7,0xC0,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x9F,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x1F,0xFF,0xFE,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x0F,0xFF,0xFE,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xF0,0x0F,0xFF,0xFE,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x80,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x07,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x0F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-0x07,0x1E,0x21,0xE0,0x8E,0x0C,0xE0,0x8E,0x3E,0x70,0x38,0x23,0x80,
-0x08,0x90,0x51,0x11,0x91,0x15,0x11,0x91,0x20,0x88,0x44,0x64,0x40,
-0x08,0x10,0x51,0x12,0x91,0x24,0x12,0x81,0x20,0x88,0x04,0xA0,0x40,
-0x08,0x1C,0x89,0xE0,0x91,0x44,0x20,0x82,0x3E,0x88,0x08,0x21,0x80,
-0x08,0x10,0xF9,0x00,0x91,0x7E,0x40,0x84,0x20,0x8B,0x10,0x20,0x40,
-0x08,0x90,0x89,0x00,0x91,0x04,0x80,0x88,0x20,0x88,0x20,0x24,0x40,
-0x07,0x11,0x05,0x00,0x8E,0x05,0xF0,0x9F,0x3E,0x70,0x7C,0x23,0x80,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 };
+//1007 bytes packed from 2756
+#define Splash_Yellow_Packed_SIZE (2756)
+const uint8_t Splash_Yellow_Packed[1007] PROGMEM =
+{ 0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,0x00,0xFF,
+0x00,0xAB,0x00,0x00,0x07,0x8A,0x00,0x00,0x1F,0x8A,0x00,0x00,0x7F,
+0x89,0x00,0x01,0x01,0xFF,0x89,0x00,0x01,0x0F,0xFF,0x89,0x00,0x01,
+0x3F,0xFF,0x89,0x00,0x80,0xFF,0x88,0x00,0x02,0x07,0xFF,0xFF,0x88,
+0x00,0x02,0x1F,0xFF,0xFF,0x88,0x00,0x02,0x7F,0xFF,0xFF,0x87,0x00,
+0x00,0x01,0x81,0xFF,0x87,0x00,0x00,0x0F,0x81,0xFF,0x87,0x00,0x00,
+0x3F,0x81,0xFF,0x87,0x00,0x82,0xFF,0x86,0x00,0x00,0x07,0x82,0xFF,
+0x86,0x00,0x00,0x1F,0x82,0xFF,0x86,0x00,0x00,0x7F,0x82,0xFF,0x85,
+0x00,0x00,0x01,0x83,0xFF,0x85,0x00,0x00,0x0F,0x83,0xFF,0x85,0x00,
+0x00,0x3E,0x83,0xFF,0x85,0x00,0x01,0xFE,0x7F,0x82,0xFF,0x84,0x00,
+0x02,0x07,0xFE,0x7F,0x82,0xFF,0x84,0x00,0x02,0x1F,0xFC,0x7F,0x82,
+0xFF,0x84,0x00,0x02,0x7F,0xF8,0x3F,0x82,0xFF,0x83,0x00,0x03,0x01,
+0xFF,0xF0,0x7F,0x82,0xFF,0x83,0x00,0x02,0x0F,0xFF,0xE0,0x83,0xFF,
+0x83,0x00,0x02,0x3F,0xFF,0xE1,0x83,0xFF,0x83,0x00,0x02,0x7F,0xFF,
+0xC3,0x83,0xFF,0x83,0x00,0x02,0x3F,0xFF,0x87,0x83,0xFF,0x83,0x00,
+0x02,0x3F,0xFF,0x07,0x83,0xFF,0x83,0x00,0x02,0x3F,0xFE,0x0F,0x83,
+0xFF,0x83,0x00,0x02,0x1F,0xFE,0x1F,0x83,0xFF,0x83,0x00,0x02,0x1F,
+0xFC,0x3F,0x83,0xFF,0x83,0x00,0x02,0x1F,0xF0,0x7F,0x83,0xFF,0x83,
+0x00,0x02,0x0F,0x80,0x3F,0x83,0xFF,0x83,0x00,0x02,0x0C,0x00,0x03,
+0x83,0xFF,0x84,0x00,0x02,0x02,0x00,0x7F,0x82,0xFF,0x84,0x00,0x02,
+0x1F,0xC0,0x07,0x82,0xFF,0x84,0x00,0x02,0xFF,0xF8,0x03,0x82,0xFF,
+0x83,0x00,0x03,0x07,0xFF,0xFF,0x01,0x82,0xFF,0x83,0x00,0x03,0x07,
+0xFF,0xFF,0xF1,0x82,0xFF,0x83,0x00,0x03,0x03,0xFF,0xFF,0xFD,0x82,
+0xFF,0x83,0x00,0x00,0x03,0x85,0xFF,0x83,0x00,0x00,0x03,0x85,0xFF,
+0x83,0x00,0x02,0x01,0xFE,0x03,0x83,0xFF,0x83,0x00,0x02,0x01,0xF8,
+0x00,0x83,0xFF,0x83,0x00,0x03,0x01,0xE0,0x00,0x7F,0x82,0xFF,0x83,
+0x00,0x03,0x01,0xC0,0x3C,0x3F,0x82,0xFF,0x84,0x00,0x02,0x83,0x3E,
+0x1F,0x82,0xFF,0x84,0x00,0x02,0x87,0x1F,0x1F,0x82,0xFF,0x84,0x00,
+0x02,0x0F,0x1F,0x9F,0x82,0xFF,0x84,0x00,0x02,0x1F,0x9F,0x9F,0x82,
+0xFF,0x84,0x00,0x02,0x1F,0x8F,0x9F,0x82,0xFF,0x84,0x00,0x02,0x1F,
+0x8F,0x9F,0x82,0xFF,0x84,0x00,0x02,0x1F,0xCF,0x1F,0x82,0xFF,0x84,
+0x00,0x02,0x1F,0xC6,0x1F,0x82,0xFF,0x84,0x00,0x02,0x0F,0xC4,0x3F,
+0x82,0xFF,0x84,0x00,0x02,0x07,0xC0,0x3F,0x82,0xFF,0x85,0x00,0x01,
+0xE0,0x7F,0x82,0xFF,0x85,0x00,0x02,0xE1,0xFF,0xF7,0x81,0xFF,0x84,
+0x00,0x03,0x10,0x67,0xFF,0xC7,0x81,0xFF,0x84,0x00,0x03,0x0C,0x7F,
+0xFE,0x03,0x81,0xFF,0x84,0x00,0x03,0x0F,0xFF,0xE0,0x03,0x81,0xFF,
+0x84,0x00,0x03,0x0F,0xFF,0x00,0x1F,0x81,0xFF,0x84,0x00,0x02,0x07,
+0xF8,0x00,0x82,0xFF,0x84,0x00,0x02,0x07,0xC0,0x0F,0x82,0xFF,0x84,
+0x00,0x03,0x06,0x00,0x7F,0xFD,0x81,0xFF,0x85,0x00,0x02,0x03,0xFF,
+0xF1,0x81,0xFF,0x85,0x00,0x02,0x1F,0xFF,0x80,0x81,0xFF,0x85,0x00,
+0x02,0xFF,0xF8,0x00,0x81,0xFF,0x84,0x00,0x03,0x03,0xFF,0xC0,0x07,
+0x81,0xFF,0x84,0x00,0x03,0x01,0xFE,0x00,0x3F,0x81,0xFF,0x84,0x00,
+0x02,0x01,0xF0,0x03,0x82,0xFF,0x84,0x00,0x02,0x01,0x80,0x1F,0x82,
+0xFF,0x86,0x00,0x83,0xFF,0x85,0x00,0x00,0x07,0x83,0xFF,0x85,0x00,
+0x00,0x3F,0x83,0xFF,0x85,0x00,0x02,0x7F,0x80,0x7F,0x81,0xFF,0x85,
+0x00,0x02,0x7C,0x00,0x3F,0x81,0xFF,0x85,0x00,0x02,0x78,0x00,0x1F,
+0x81,0xFF,0x85,0x00,0x02,0x70,0x3F,0x0F,0x81,0xFF,0x85,0x00,0x02,
+0x20,0xFF,0x87,0x81,0xFF,0x85,0x00,0x02,0x23,0xFF,0xC7,0x81,0xFF,
+0x85,0x00,0x02,0x03,0xFF,0xE7,0x81,0xFF,0x85,0x00,0x02,0x07,0xFF,
+0xE7,0x81,0xFF,0x85,0x00,0x02,0x07,0xFF,0xE7,0x81,0xFF,0x85,0x00,
+0x02,0x07,0xFF,0xE7,0x81,0xFF,0x85,0x00,0x02,0x07,0xFF,0xC7,0x81,
+0xFF,0x85,0x00,0x02,0x07,0xFF,0x87,0x81,0xFF,0x85,0x00,0x02,0x03,
+0xFF,0x0F,0x81,0xFF,0x85,0x00,0x02,0x01,0xFC,0x0F,0x81,0xFF,0x87,
+0x00,0x00,0x1F,0x81,0xFF,0x87,0x00,0x00,0x7F,0x81,0xFF,0x85,0x00,
+0x02,0x04,0x01,0xFC,0x81,0xFF,0x85,0x00,0x02,0x03,0x9F,0xF8,0x81,
+0xFF,0x85,0x00,0x05,0x03,0xFF,0xE0,0x7F,0xFF,0xFF,0x85,0x00,0x02,
+0x03,0xFF,0xC1,0x81,0xFF,0x85,0x00,0x02,0x01,0xFF,0x03,0x81,0xFF,
+0x85,0x00,0x02,0x01,0xFE,0x0F,0x81,0xFF,0x85,0x00,0x02,0x01,0xFC,
+0x1F,0x81,0xFF,0x85,0x00,0x02,0x01,0xF0,0x7F,0x81,0xFF,0x86,0x00,
+0x00,0xE0,0x82,0xFF,0x86,0x00,0x00,0x83,0x82,0xFF,0x86,0x00,0x04,
+0x07,0xE0,0x1F,0xFF,0xFF,0x88,0x00,0x02,0x1F,0xFF,0xFF,0x88,0x00,
+0x02,0x0F,0xFF,0xFF,0x86,0x00,0x04,0x1F,0xFC,0x0F,0xFF,0xFF,0x86,
+0x00,0x04,0x3F,0xF8,0x3F,0xFF,0xFF,0x86,0x00,0x01,0x3F,0xE0,0x81,
+0xFF,0x86,0x00,0x01,0x3F,0xC1,0x81,0xFF,0x86,0x00,0x01,0x3F,0x07,
+0x81,0xFF,0x86,0x00,0x01,0x1C,0x0F,0x81,0xFF,0x86,0x00,0x01,0x18,
+0x3F,0x81,0xFF,0x87,0x00,0x82,0xFF,0x88,0x00,0x02,0x01,0xFF,0xFF,
+0x88,0x00,0x02,0x01,0xFF,0xFF,0x88,0x00,0x02,0x01,0xFF,0xFF,0x86,
+0x00,0x00,0x07,0x82,0xFF,0x86,0x00,0x00,0x07,0x82,0xFF,0x86,0x00,
+0x00,0x07,0x82,0xFF,0x86,0x00,0x00,0x07,0x82,0xFF,0x86,0x00,0x00,
+0x03,0x82,0xFF,0x86,0x00,0x00,0x03,0x82,0xFF,0x86,0x00,0x00,0x03,
+0x82,0xFF,0x86,0x00,0x00,0x01,0x82,0xFF,0x86,0x00,0x00,0x01,0x82,
+0xFF,0x86,0x00,0x00,0x01,0x82,0xFF,0x87,0x00,0x82,0xFF,0x87,0x00,
+0x82,0xFF,0x87,0x00,0x82,0xFF,0x87,0x00,0x82,0xFF,0x87,0x00,0x00,
+0x7F,0x81,0xFF,0x87,0x00,0x03,0x0F,0xC7,0xDC,0x7F,0x87,0x00,0x03,
+0x77,0xBB,0x9B,0xBF,0x87,0x00,0x03,0x37,0xFB,0x5F,0xBF,0x87,0x00,
+0x03,0x37,0xF7,0xDE,0x7F,0x87,0x00,0x03,0x34,0xEF,0xDF,0xBF,0x87,
+0x00,0x03,0x17,0xDF,0xDB,0xBF,0x87,0x00,0x03,0x0F,0x83,0xDC,0x7F,
+0x87,0x00,0x00,0x1F,0x81,0xFF };
+
+//1599 bytes packed from 2756
+#define Splash_Mono_Packed_SIZE (2756)
+const uint8_t Splash_Mono_Packed[1599] PROGMEM =
+{ 0x99,0xFF,0x02,0xFD,0xFF,0x7F,0x88,0xFF,0x02,0xF8,0xFC,0x3F,0x88,
+0xFF,0x02,0xF2,0x38,0x9F,0x88,0xFF,0x02,0xC7,0x33,0xCF,0x88,0xFF,
+0x02,0x8F,0xE7,0xE3,0x88,0xFF,0x02,0x1F,0x87,0xE1,0x87,0xFF,0x03,
+0xFE,0x1F,0x07,0xE0,0x87,0xFF,0x03,0xFE,0x1F,0x07,0xE0,0x87,0xFF,
+0x03,0xFE,0x1F,0x07,0xF0,0x89,0xFF,0x00,0x07,0x88,0xFF,0x04,0xC0,
+0x01,0x04,0x00,0x0F,0x86,0xFF,0x04,0xC0,0x01,0x06,0x00,0x0F,0x86,
+0xFF,0x02,0xC0,0x01,0x07,0x88,0xFF,0x04,0xC0,0x01,0x04,0x00,0x0F,
+0x86,0xFF,0x02,0xC0,0x01,0x07,0x88,0xFF,0x02,0xC0,0x01,0x07,0x88,
+0xFF,0x04,0xC0,0x01,0x04,0x00,0x0F,0x86,0xFF,0x02,0xC0,0x01,0x07,
+0x88,0xFF,0x04,0xC0,0x01,0x06,0x00,0x0F,0x86,0xFF,0x04,0xC0,0x01,
+0x04,0x00,0x0F,0x86,0xFF,0x02,0xC0,0x01,0x07,0x88,0xFF,0x04,0xC0,
+0x01,0x04,0x00,0x0F,0x86,0xFF,0x04,0xE0,0x01,0x04,0x00,0x0F,0x88,
+0xFF,0x00,0x07,0x88,0xFF,0x03,0xFE,0x1F,0x07,0xF0,0x87,0xFF,0x03,
+0xFE,0x1F,0x07,0xE0,0x87,0xFF,0x03,0xFE,0x1F,0x87,0xE0,0x88,0xFF,
+0x02,0x1F,0xC7,0xE1,0x88,0xFF,0x02,0x8F,0xE3,0xE7,0x88,0xFF,0x02,
+0xE7,0x31,0xCF,0x88,0xFF,0x02,0xF0,0x78,0x1F,0x88,0xFF,0x02,0xF8,
+0xFE,0x3F,0xFF,0xFF,0xFF,0xFF,0x92,0xFF,0x00,0xBF,0x89,0xFF,0x01,
+0xFE,0x1F,0x8A,0xFF,0x01,0x1F,0xFD,0x89,0xFF,0x01,0x1F,0xF1,0x89,
+0xFF,0x01,0x0F,0xE3,0x89,0xFF,0x01,0x8F,0xE3,0x89,0xFF,0x01,0x87,
+0xE3,0x89,0xFF,0x80,0xC7,0x89,0xFF,0x01,0xC3,0xC7,0x89,0xFF,0x01,
+0xE3,0x8F,0x89,0xFF,0x01,0xE3,0x8F,0x88,0xFF,0x02,0x03,0xE1,0x8F,
+0x87,0xFF,0x03,0xFC,0x01,0xF1,0x07,0x87,0xFF,0x03,0xF8,0x00,0xF0,
+0x01,0x87,0xFF,0x03,0xF0,0xF8,0x78,0x20,0x87,0xFF,0x04,0xE1,0xFB,
+0xF8,0x30,0x3F,0x86,0xFF,0x04,0xE3,0xFF,0xFC,0x7C,0x0F,0x86,0xFF,
+0x05,0xE3,0xFF,0xFC,0x7E,0x07,0xFE,0x81,0xFF,0x09,0xFE,0xFF,0xFF,
+0x9F,0xE3,0xFF,0xFC,0x3F,0x81,0xF8,0x81,0xFF,0x09,0xF8,0xFF,0xFC,
+0x07,0xC3,0xFF,0xFE,0x3F,0xC3,0xC0,0x81,0xFF,0x09,0xF8,0x7F,0xF0,
+0x03,0xE3,0xFF,0xCE,0x1F,0xEF,0x00,0x81,0xFF,0x09,0xFC,0x7F,0xE0,
+0xC1,0xE3,0xFF,0x8F,0x1F,0xFC,0x00,0x81,0xFF,0x09,0xFC,0x3F,0xC3,
+0xE1,0xE1,0xFF,0x8F,0x0F,0xE0,0x00,0x81,0xFF,0x3A,0xFE,0x3F,0x8F,
+0xF1,0xE1,0xFF,0x8F,0x8F,0x80,0x00,0xFF,0xFF,0xE3,0xFE,0x1F,0x0F,
+0xF0,0xF0,0xFF,0x8F,0xBE,0x00,0x00,0xFF,0xFF,0x00,0xFF,0x1F,0x1F,
+0xE0,0xF0,0xFF,0x1F,0xF8,0x00,0x00,0xFF,0xFC,0x00,0x7F,0x1F,0x1F,
+0xC0,0x78,0x7E,0x1F,0xC0,0x00,0x00,0xFF,0xF0,0x00,0x3F,0x0F,0x3F,
+0x04,0x7C,0x18,0x3F,0x81,0x00,0x09,0xFF,0x80,0x7E,0x1F,0x8F,0xFC,
+0x1C,0x3E,0x00,0x7C,0x81,0x00,0x09,0xFE,0x01,0xFE,0x1F,0x87,0xF8,
+0x3C,0x3F,0x01,0xE0,0x81,0x00,0x09,0xFF,0x0F,0xFF,0x1F,0xC7,0xF0,
+0xFE,0x1F,0xFF,0x80,0x81,0x00,0x08,0xFF,0x0F,0xFF,0x1F,0xC3,0xE1,
+0xFE,0x1F,0xFE,0x82,0x00,0x08,0xFF,0x8F,0xFF,0x1F,0xE3,0xE3,0xFC,
+0x0F,0xF0,0x82,0x00,0x08,0xFF,0x87,0xFE,0x3F,0xE3,0xE3,0xFC,0x87,
+0xC0,0x82,0x00,0x07,0xFF,0x87,0xFC,0x3F,0xE1,0xE3,0xF8,0x9F,0x83,
+0x00,0x07,0xFF,0xC3,0xF0,0x03,0xF1,0xE1,0xF1,0xFC,0x83,0x00,0x07,
+0xFF,0xC3,0xC0,0x01,0xF0,0xF0,0x03,0xE0,0x83,0x00,0x07,0xFF,0xE3,
+0x00,0xE0,0xF8,0xF0,0x07,0x81,0x83,0x00,0x08,0xFF,0xE0,0x07,0xF0,
+0xF8,0x78,0x1E,0x01,0x80,0x82,0x00,0x08,0xFF,0xF0,0x1F,0xF8,0x7C,
+0x7F,0xF0,0x01,0x80,0x82,0x00,0x08,0xFF,0xF0,0xFF,0xF8,0x7C,0x7F,
+0xC0,0x03,0x80,0x82,0x00,0x08,0xFF,0xF0,0xFF,0xF8,0x7C,0x3F,0x00,
+0x07,0xC0,0x82,0x00,0x08,0xFF,0xF8,0x7F,0xF8,0x7E,0xFC,0x00,0x0F,
+0x80,0x82,0x00,0x07,0xFF,0xF8,0x7F,0xF8,0x7F,0xE0,0x00,0x1F,0x83,
+0x00,0x07,0xFF,0xFC,0x7F,0xF0,0xFF,0x80,0x00,0x1E,0x83,0x00,0x07,
+0xFF,0xFC,0x3F,0xE0,0xFE,0x00,0x00,0x3C,0x83,0x00,0x07,0xFF,0xFE,
+0x3F,0x81,0xF0,0x00,0x00,0x78,0x83,0x00,0x07,0xFF,0xFE,0x1C,0x07,
+0xC0,0x00,0x00,0xF8,0x83,0x00,0x80,0xFF,0x05,0x10,0x0F,0x00,0x00,
+0x01,0xF0,0x83,0x00,0x80,0xFF,0x05,0x00,0x7C,0x00,0x00,0x01,0xE0,
+0x83,0x00,0x80,0xFF,0x05,0x01,0xE0,0x00,0x00,0x03,0xC0,0x83,0x00,
+0x80,0xFF,0x05,0x87,0x80,0x00,0x00,0x0F,0x80,0x83,0x00,0x80,0xFF,
+0x00,0x9E,0x81,0x00,0x01,0x7F,0xC0,0x83,0x00,0x80,0xFF,0x05,0xF0,
+0x00,0x18,0x03,0xFF,0xFC,0x83,0x00,0x80,0xFF,0x06,0xC0,0x01,0x1F,
+0x1F,0xFD,0xFF,0x80,0x82,0x00,0x80,0xFF,0x06,0x00,0x07,0x1F,0x9F,
+0xE0,0x3F,0xF8,0x82,0x00,0x08,0xFF,0xFC,0x00,0x1F,0x9F,0xCF,0x00,
+0x07,0xFC,0x82,0x00,0x08,0xFF,0xE0,0x00,0x3F,0x81,0xC8,0x00,0x00,
+0xFE,0x82,0x00,0x08,0xFF,0x80,0x00,0x7D,0x80,0xE0,0x00,0x00,0x0E,
+0x82,0x00,0x08,0xFE,0x00,0x00,0x79,0xC0,0xE0,0x00,0x00,0x02,0x82,
+0x00,0x05,0xF0,0x00,0x00,0x71,0xC0,0x60,0x85,0x00,0x05,0xC0,0x00,
+0x00,0xE0,0xC0,0x70,0x88,0x00,0x80,0xE0,0x02,0x70,0x01,0xFC,0x86,
+0x00,0x80,0xE0,0x02,0x70,0x07,0xFF,0x86,0x00,0x05,0xE0,0x60,0xE0,
+0x1F,0xFF,0x80,0x85,0x00,0x05,0x60,0x71,0xE0,0x3F,0xC3,0xC0,0x85,
+0x00,0x05,0x70,0x73,0xE0,0x7C,0xC1,0xE0,0x85,0x00,0x05,0x78,0x3F,
+0xC0,0x78,0xE0,0xE0,0x85,0x00,0x05,0x3F,0xFF,0x80,0xF0,0xE0,0x60,
+0x85,0x00,0x05,0x1F,0xFF,0x04,0xE0,0x60,0x60,0x85,0x00,0x05,0x0F,
+0xFC,0x1E,0xE0,0x70,0x60,0x86,0x00,0x04,0xC0,0x0E,0xE0,0x70,0x60,
+0x87,0x00,0x03,0x0E,0xE0,0x30,0xE0,0x87,0x00,0x03,0x1E,0x60,0x39,
+0xE0,0x87,0x00,0x03,0xFE,0x70,0x3B,0xC0,0x85,0x00,0x05,0x0E,0x03,
+0xFC,0x78,0x3F,0xC0,0x85,0x00,0x05,0x06,0x1F,0xF0,0x3F,0x1F,0x80,
+0x85,0x00,0x06,0x07,0xFF,0x80,0x1F,0x1E,0x00,0x08,0x84,0x00,0x06,
+0x07,0xFE,0x00,0x0F,0x98,0x00,0x38,0x84,0x00,0x06,0x3F,0xF0,0x00,
+0x03,0x80,0x01,0xFC,0x83,0x00,0x07,0x01,0xFF,0x80,0x01,0x80,0x00,
+0x1F,0xFC,0x84,0x00,0x06,0xFF,0x80,0x0F,0xC0,0x00,0xFF,0xE0,0x84,
+0x00,0x05,0x21,0x80,0x7F,0xC0,0x07,0xFF,0x85,0x00,0x05,0x02,0x03,
+0xFF,0x00,0x3F,0xF0,0x86,0x00,0x05,0x1F,0xF8,0x01,0xFF,0x80,0x02,
+0x85,0x00,0x05,0x7F,0xC0,0x07,0xFC,0x00,0x0E,0x85,0x00,0x05,0xFE,
+0x00,0x27,0xE0,0x00,0x7F,0x84,0x00,0x06,0x10,0xF0,0x00,0xF7,0x00,
+0x07,0xFF,0x84,0x00,0x06,0x78,0xC0,0x07,0xF0,0x00,0x3F,0xF8,0x84,
+0x00,0x06,0x78,0x00,0x3F,0xF0,0x01,0xFF,0xC0,0x84,0x00,0x05,0x30,
+0x01,0xFF,0x80,0x0F,0xFC,0x86,0x00,0x04,0x07,0xFC,0x00,0x7F,0xE0,
+0x86,0x00,0x03,0x0F,0xE0,0x01,0xFF,0x87,0x00,0x03,0x1F,0x00,0x01,
+0xF8,0x87,0x00,0x03,0x1E,0x00,0x01,0xC0,0x87,0x00,0x00,0x1C,0x81,
+0x00,0x01,0x7F,0x80,0x85,0x00,0x05,0x1C,0x00,0x00,0x03,0xFF,0xC0,
+0x85,0x00,0x05,0x1C,0x00,0x00,0x07,0xFF,0xE0,0x85,0x00,0x05,0x1C,
+0x00,0x06,0x0F,0xC0,0xF0,0x85,0x00,0x05,0x0E,0x00,0x3F,0x1F,0x00,
+0x78,0x85,0x00,0x05,0x0E,0x01,0xFF,0x1C,0x00,0x38,0x85,0x00,0x05,
+0x07,0x8F,0xFC,0x3C,0x00,0x18,0x85,0x00,0x05,0x03,0xFF,0xE0,0x38,
+0x00,0x18,0x85,0x00,0x05,0x01,0xFF,0x00,0x38,0x00,0x18,0x85,0x00,
+0x05,0x0F,0xF8,0x00,0x38,0x00,0x18,0x85,0x00,0x05,0x7F,0xE0,0x00,
+0x38,0x00,0x38,0x84,0x00,0x06,0x01,0xFF,0x00,0x00,0x18,0x00,0x78,
+0x84,0x00,0x06,0x01,0xF8,0x00,0x00,0x1C,0x00,0xF0,0x85,0x00,0x05,
+0xC0,0x00,0x00,0x1E,0x03,0xF0,0x88,0x00,0x02,0x0F,0xFF,0xE0,0x88,
+0x00,0x02,0x07,0xFF,0x80,0x88,0x00,0x02,0x03,0xFE,0x03,0x87,0x00,
+0x03,0x0F,0xF0,0x60,0x07,0x85,0x00,0x06,0x07,0xFF,0xFF,0xF8,0x00,
+0x1F,0x80,0x84,0x00,0x05,0x3F,0xFF,0xFF,0xF8,0x00,0x3E,0x85,0x00,
+0x05,0x3F,0xFF,0xC0,0xF8,0x00,0xFC,0x85,0x00,0x05,0x1F,0x00,0x03,
+0xE0,0x01,0xF0,0x87,0x00,0x03,0x07,0xC0,0x03,0xE0,0x87,0x00,0x03,
+0x1F,0x00,0x0F,0x80,0x87,0x00,0x02,0x3E,0x00,0x1F,0x88,0x00,0x02,
+0xFC,0x00,0x7C,0x87,0x00,0x05,0x01,0xF0,0x00,0xF8,0x1F,0xE0,0x85,
+0x00,0x05,0x07,0xE0,0x00,0xFF,0xFF,0xE0,0x85,0x00,0x05,0x0F,0x80,
+0x00,0xFF,0xFF,0xF0,0x85,0x00,0x05,0x1F,0x00,0x00,0x60,0x03,0xF0,
+0x85,0x00,0x00,0x7C,0x81,0x00,0x01,0x07,0xC0,0x85,0x00,0x00,0xF8,
+0x81,0x00,0x00,0x1F,0x85,0x00,0x05,0x03,0xE0,0x01,0xFF,0xC0,0x3E,
+0x85,0x00,0x00,0x01,0x81,0xFF,0x01,0xC0,0xF8,0x85,0x00,0x00,0x01,
+0x81,0xFF,0x01,0xC3,0xF0,0x85,0x00,0x05,0x01,0xFF,0xF8,0x07,0xE7,
+0xC0,0x88,0x00,0x01,0x0F,0x9F,0x89,0x00,0x03,0x3E,0x1F,0xFF,0xFE,
+0x87,0x00,0x03,0xFC,0x0F,0xFF,0xFE,0x86,0x00,0x04,0x01,0xF0,0x0F,
+0xFF,0xFE,0x86,0x00,0x01,0x07,0xE0,0x89,0x00,0x01,0x0F,0x80,0x89,
+0x00,0x00,0x3F,0x8A,0x00,0x00,0xFC,0x89,0x00,0x01,0x01,0xF8,0x89,
+0x00,0x01,0x07,0xE0,0x89,0x00,0x01,0x0F,0xC0,0x89,0x00,0x00,0x1F,
+0x8A,0x00,0x00,0x0E,0x8A,0x00,0x00,0x08,0xC6,0x00,0x5A,0x07,0x1E,
+0x21,0xE0,0x8E,0x0C,0xE0,0x8E,0x3E,0x70,0x38,0x23,0x80,0x08,0x90,
+0x51,0x11,0x91,0x15,0x11,0x91,0x20,0x88,0x44,0x64,0x40,0x08,0x10,
+0x51,0x12,0x91,0x24,0x12,0x81,0x20,0x88,0x04,0xA0,0x40,0x08,0x1C,
+0x89,0xE0,0x91,0x44,0x20,0x82,0x3E,0x88,0x08,0x21,0x80,0x08,0x10,
+0xF9,0x00,0x91,0x7E,0x40,0x84,0x20,0x8B,0x10,0x20,0x40,0x08,0x90,
+0x89,0x00,0x91,0x04,0x80,0x88,0x20,0x88,0x20,0x24,0x40,0x07,0x11,
+0x05,0x00,0x8E,0x05,0xF0,0x9F,0x3E,0x70,0x7C,0x23,0x80,0x8B,0x00 };
 
 #endif 
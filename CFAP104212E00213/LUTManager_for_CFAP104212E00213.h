@@ -0,0 +1,96 @@
+#ifndef __LUTMANAGER_FOR_CFAP104212E00213_H__
+#define __LUTMANAGER_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Waveform LUT manager
+//
+// Remembers which Panel Setting and which register LUTs the controller holds
+// so switching profiles (see LUT_PROFILE[]) only sends what changed. The
+// 212 bytes of register LUTs are uploaded once and stay resident until the
+// controller is reset or put into deep sleep; call invalidate() then.
+//
+// select() records the sketch's choice and loads it. ePaperTemperature may
+// then load another profile in its place for the panel's temperature, see
+// TEMP_BAND[]; selecting the same profile again leaves that in place.
+//=============================================================================
+
+template<class BUS>
+struct ePaperLUT
+{
+  //Forget what the controller holds, after a reset or deep sleep
+  static void invalidate(void)
+  {
+    panel_setting = 0;
+    resident = 0;
+    profile = 0xff;
+    chosen = 0xff;
+  }
+
+  //Make profile id (LUT_TRICOLOR, LUT_FAST_BW, ...) the active waveform
+  static void select(uint8_t id)
+  {
+    if (id == chosen)
+    {
+      return;
+    }
+    chosen = id;
+    load(id);
+  }
+
+  //Load profile id, whatever was selected
+  static void load(uint8_t id)
+  {
+    if (id == profile)
+    {
+      return;
+    }
+    LUT_Profile p;
+    memcpy_P(&p, &LUT_PROFILE[id], sizeof(p));
+
+    //In order for register LUTs to take effect, command 0x00 must have bit
+    //5 set to "1". Set the Panel Setting first, then upload if needed.
+    if (p.panel_setting != panel_setting)
+    {
+      BUS::writeCMDFill(0x00, p.panel_setting, 1);
+      panel_setting = p.panel_setting;
+    }
+    if ((p.table[0] != 0) && (p.table[0] != resident))
+    {
+      EPD_TIMED(TIMING_LUT, id);
+      for (uint8_t i = 0; i < 5; i++)
+      {
+        BUS::writeCMDData_Flash(0x20 + i, p.table[i], pgm_read_byte(&LUT_LENGTHS[i]));
+      }
+      resident = p.table[0];
+    }
+    profile = id;
+  }
+
+  //The loaded profile, 0xff if unknown
+  static inline uint8_t current(void) { return profile; }
+
+  //The selected profile, 0xff if none since invalidate()
+  static inline uint8_t selected(void) { return chosen; }
+
+  //True if the active profile is B/W only (0x10 = OLD, 0x13 = NEW)
+  static inline bool bwOnly(void) { return 0 != (panel_setting & 0x10); }
+
+private:
+  static uint8_t panel_setting;
+  static const unsigned char *resident;
+  static uint8_t profile;
+  static uint8_t chosen;
+};
+
+template<class BUS> uint8_t ePaperLUT<BUS>::panel_setting = 0;
+template<class BUS> const unsigned char *ePaperLUT<BUS>::resident = 0;
+template<class BUS> uint8_t ePaperLUT<BUS>::profile = 0xff;
+template<class BUS> uint8_t ePaperLUT<BUS>::chosen = 0xff;
+
+//=============================================================================
+#endif
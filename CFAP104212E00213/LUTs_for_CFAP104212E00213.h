@@ -93,5 +93,37 @@ const unsigned char B2B_LUT_LUTBB_LUTB_PARTIAL[] PROGMEM =  {
   0x00	,0x00	,0x00	,0x00	,0x00	,0x00,
   0x00	,0x00	,0x00	,0x00	,0x00	,0x00, };
 
+//=============================================================================
+// LUT profiles
+//
+// Each profile is a Panel Setting (0x00) value plus, when bit 5 (REG) is set,
+// the five register LUTs to upload. Bit 4 (KW/R) selects B/W only mode, where
+// 0x10 carries the OLD image and 0x13 the NEW one instead of BW and yellow.
+#define LUT_TRICOLOR  (0) //OTP waveform, black/white/yellow, full quality
+#define LUT_FAST_BW   (1) //register waveform, black/white only, no yellow phases
+#define LUT_PARTIAL   (2) //register waveform for partial updates
+#define LUT_OTP_BW    (3) //OTP waveform, black/white only
+#define LUT_PROFILES  (4)
+
+//Lengths of the tables for commands 0x20..0x24
+const uint8_t LUT_LENGTHS[5] PROGMEM = { 44, 42, 42, 42, 42 };
+
+struct LUT_Profile
+{
+  uint8_t panel_setting;
+  //VCOM, WW, BW/R, WB/W, BB/B, or all 0 for OTP
+  const unsigned char *table[5];
+};
+
+const LUT_Profile LUT_PROFILE[LUT_PROFILES] PROGMEM =
+{
+  { 0x83, { 0, 0, 0, 0, 0 } },
+  { 0xb3, { VCOM_LUT_LUTC, W2W_LUT_LUTWW, B2W_LUT_LUTBW_LUTR,
+            W2B_LUT_LUTWB_LUTW, B2B_LUT_LUTBB_LUTB } },
+  { 0xb3, { VCOM_LUT_LUTC_PARTIAL, W2W_LUT_LUTWW_PARTIAL, B2W_LUT_LUTBW_LUTR_PARTIAL,
+            W2B_LUT_LUTWB_LUTW_PARTIAL, B2B_LUT_LUTBB_LUTB_PARTIAL } },
+  { 0x93, { 0, 0, 0, 0, 0 } },
+};
+
 //=============================================================================
 #endif 
@@ -0,0 +1,287 @@
+#ifndef __ORIENT_FOR_CFAP104212E00213_H__
+#define __ORIENT_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Rotation and mirroring
+//
+// An orientation is three flags applied to source pixel (x, y) in order:
+//
+//   ORIENT_SWAP_XY   x and y change places, the source is EPD_VRES wide
+//   ORIENT_MIRROR_X  panel x = EPD_HRES - 1 - x
+//   ORIENT_MIRROR_Y  panel y = EPD_VRES - 1 - y
+//
+// which covers the four rotations and their mirror images. ROTATE_90 turns
+// a landscape (212 x 104) image clockwise onto the portrait panel.
+//
+// writeOrientedBand() takes a band of source rows, as a decoder produces
+// them, and writes it where it lands on the panel. Without SWAP_XY a source
+// row is a panel row, reversed with BIT_REVERSE[] for MIRROR_X. With
+// SWAP_XY every 8 source rows become one byte wide column of the panel: the
+// band is cut into 8x8 blocks and each block is transposed, so nothing is
+// handled a pixel at a time and no frame buffer is needed.
+//=============================================================================
+
+#define ORIENT_MIRROR_X (0x01)
+#define ORIENT_MIRROR_Y (0x02)
+#define ORIENT_SWAP_XY  (0x04)
+
+#define ROTATE_0   (0)
+#define ROTATE_90  (ORIENT_SWAP_XY | ORIENT_MIRROR_X)
+#define ROTATE_180 (ORIENT_MIRROR_X | ORIENT_MIRROR_Y)
+#define ROTATE_270 (ORIENT_SWAP_XY | ORIENT_MIRROR_Y)
+
+//Bytes in the longest source row, a landscape row
+#define EPD_MAX_ROW_BYTES ((EPD_VRES + 7) / 8)
+
+//Source rows per band, a multiple of 8 so a rotated band fills whole bytes.
+//Each row of band costs 2 * EPD_MAX_ROW_BYTES of SRAM.
+#ifndef EPD_BAND_ROWS
+#define EPD_BAND_ROWS (8)
+#endif
+#if (EPD_BAND_ROWS % 8) != 0
+#error EPD_BAND_ROWS must be a multiple of 8
+#endif
+
+//Band buffers shared by the decoders (BMP, .EPD and packed flash images),
+//rows of orientRowBytes() bytes
+uint8_t epd_band_bw[EPD_BAND_ROWS * EPD_MAX_ROW_BYTES];
+uint8_t epd_band_yellow[EPD_BAND_ROWS * EPD_MAX_ROW_BYTES];
+
+const uint8_t BIT_REVERSE[256] PROGMEM =
+{
+  0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+  0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+  0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+  0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+  0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+  0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+  0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+  0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+  0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+  0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+  0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+  0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+  0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+  0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+  0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+  0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF
+};
+
+//Size of the source image for an orientation
+static inline uint16_t orientWidth(uint8_t orientation)
+{
+  return (orientation & ORIENT_SWAP_XY) ? EPD_VRES : EPD_HRES;
+}
+
+static inline uint16_t orientHeight(uint8_t orientation)
+{
+  return (orientation & ORIENT_SWAP_XY) ? EPD_HRES : EPD_VRES;
+}
+
+static inline uint8_t orientRowBytes(uint8_t orientation)
+{
+  return (orientWidth(orientation) + 7) / 8;
+}
+
+//Source pixel to panel pixel
+static inline void orientPoint(uint8_t orientation, int16_t &x, int16_t &y)
+{
+  if (orientation & ORIENT_SWAP_XY)
+  {
+    int16_t t = x;
+    x = y;
+    y = t;
+  }
+  if (orientation & ORIENT_MIRROR_X)
+  {
+    x = EPD_HRES - 1 - x;
+  }
+  if (orientation & ORIENT_MIRROR_Y)
+  {
+    y = EPD_VRES - 1 - y;
+  }
+}
+
+//Panel pixel to source pixel
+static inline void unorientPoint(uint8_t orientation, int16_t &x, int16_t &y)
+{
+  if (orientation & ORIENT_MIRROR_X)
+  {
+    x = EPD_HRES - 1 - x;
+  }
+  if (orientation & ORIENT_MIRROR_Y)
+  {
+    y = EPD_VRES - 1 - y;
+  }
+  if (orientation & ORIENT_SWAP_XY)
+  {
+    int16_t t = x;
+    x = y;
+    y = t;
+  }
+}
+
+//8x8 bit matrix transpose: bit 7 - j of out[i] = bit 7 - i of in[j*stride]
+//(Hacker's Delight, transpose8)
+static void transpose8(const uint8_t *in, uint8_t stride, uint8_t *out)
+{
+  uint32_t x = ((uint32_t)in[0] << 24) | ((uint32_t)in[stride] << 16) |
+               ((uint32_t)in[2 * stride] << 8) | in[3 * stride];
+  uint32_t y = ((uint32_t)in[4 * stride] << 24) | ((uint32_t)in[5 * stride] << 16) |
+               ((uint32_t)in[6 * stride] << 8) | in[7 * stride];
+  uint32_t t;
+  t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+  out[0] = x >> 24;
+  out[1] = x >> 16;
+  out[2] = x >> 8;
+  out[3] = x;
+  out[4] = y >> 24;
+  out[5] = y >> 16;
+  out[6] = y >> 8;
+  out[7] = y;
+}
+
+//One plane of source rows that land on panel rows
+template<class BUS>
+void sendOrientedRows(uint8_t orientation, uint8_t command,
+                      const uint8_t *plane, uint8_t rows)
+{
+  uint8_t row[EPD_ROW_BYTES];
+  BUS::beginCMD(command);
+  for (uint8_t i = 0; i < rows; i++)
+  {
+    uint8_t r = (orientation & ORIENT_MIRROR_Y) ? (rows - 1 - i) : i;
+    const uint8_t *src = plane + (uint16_t)r * EPD_ROW_BYTES;
+    if (orientation & ORIENT_MIRROR_X)
+    {
+      for (uint8_t b = 0; b < EPD_ROW_BYTES; b++)
+      {
+        row[b] = pgm_read_byte(&BIT_REVERSE[src[EPD_ROW_BYTES - 1 - b]]);
+      }
+    }
+    else
+    {
+      memcpy(row, src, EPD_ROW_BYTES);
+    }
+    BUS::streamBuffer(row, EPD_ROW_BYTES);
+  }
+  BUS::endTransfer();
+}
+
+//One plane of up to 8 source rows that make one byte column of the panel
+template<class BUS>
+void sendOrientedColumn(uint8_t orientation, uint8_t command,
+                        const uint8_t *plane, uint8_t rows)
+{
+  const uint8_t stride = EPD_MAX_ROW_BYTES;
+  uint8_t block[8];
+  uint8_t out[8];
+  BUS::beginCMD(command);
+  for (uint8_t n = 0; n < stride; n++)
+  {
+    //block k holds source x 8k..8k+7, which are panel rows
+    uint8_t k = (orientation & ORIENT_MIRROR_Y) ? (stride - 1 - n) : n;
+    const uint8_t *src = plane + k;
+    if (rows < 8)
+    {
+      //pad a short band with white
+      memset(block, 0, sizeof(block));
+      for (uint8_t r = 0; r < rows; r++)
+      {
+        block[r] = src[r * stride];
+      }
+      transpose8(block, 1, out);
+    }
+    else
+    {
+      transpose8(src, stride, out);
+    }
+    uint8_t last = 7;
+    if (EPD_VRES <= (k << 3) + 7)
+    {
+      last = EPD_VRES - 1 - (k << 3);
+    }
+    uint8_t count = 0;
+    for (uint8_t j = 0; j <= last; j++)
+    {
+      uint8_t b = out[(orientation & ORIENT_MIRROR_Y) ? (last - j) : j];
+      block[count++] = (orientation & ORIENT_MIRROR_X) ? pgm_read_byte(&BIT_REVERSE[b]) : b;
+    }
+    BUS::streamBuffer(block, count);
+  }
+  BUS::endTransfer();
+}
+
+//Write source rows sy..sy + rows - 1 (both planes, orientRowBytes() bytes
+//per row) to where they land on the panel. Call between beginBands() and
+//endBands(). With SWAP_XY, sy must be a multiple of 8.
+template<class BUS>
+void writeOrientedBand(uint8_t orientation, uint16_t sy, uint8_t rows,
+                       const uint8_t *bw, const uint8_t *yellow)
+{
+  EPD_Window w;
+  if (!(orientation & ORIENT_SWAP_XY))
+  {
+    EPD_TIMED(TIMING_WINDOW, sy);
+    w.xb1 = 0;
+    w.xb2 = EPD_ROW_BYTES - 1;
+    w.y1 = (orientation & ORIENT_MIRROR_Y) ? (EPD_VRES - sy - rows) : sy;
+    w.y2 = w.y1 + rows - 1;
+    setPartialWindow<BUS>(w);
+    sendOrientedRows<BUS>(orientation, 0x10, bw, rows);
+    sendOrientedRows<BUS>(orientation, 0x13, yellow, rows);
+    return;
+  }
+  for (uint8_t r = 0; r < rows; r += 8)
+  {
+    EPD_TIMED(TIMING_WINDOW, sy + r);
+    uint8_t n = (rows - r < 8) ? (rows - r) : 8;
+    uint8_t xb = (sy + r) >> 3;
+    w.xb1 = (orientation & ORIENT_MIRROR_X) ? (EPD_ROW_BYTES - 1 - xb) : xb;
+    w.xb2 = w.xb1;
+    w.y1 = 0;
+    w.y2 = EPD_VRES - 1;
+    setPartialWindow<BUS>(w);
+    uint16_t offset = (uint16_t)r * EPD_MAX_ROW_BYTES;
+    sendOrientedColumn<BUS>(orientation, 0x10, bw + offset, n);
+    sendOrientedColumn<BUS>(orientation, 0x13, yellow + offset, n);
+  }
+}
+
+//Load a pair of packed PROGMEM planes (see Packed_for_CFAP104212E00213.h)
+//holding an orientWidth() x orientHeight() image. The panel is not
+//refreshed.
+template<class BUS>
+void loadPackedOriented(uint8_t orientation, const uint8_t *bw_packed,
+                        const uint8_t *yellow_packed)
+{
+  ePaperUnpacker bw;
+  ePaperUnpacker yellow;
+  bw.begin(bw_packed);
+  yellow.begin(yellow_packed);
+  uint8_t row_bytes = orientRowBytes(orientation);
+  uint16_t height = orientHeight(orientation);
+  beginBands<BUS>();
+  for (uint16_t sy = 0; sy < height; sy += EPD_BAND_ROWS)
+  {
+    uint8_t rows = (height - sy < EPD_BAND_ROWS) ? (height - sy) : EPD_BAND_ROWS;
+    bw.read(epd_band_bw, (uint16_t)rows * row_bytes);
+    yellow.read(epd_band_yellow, (uint16_t)rows * row_bytes);
+    writeOrientedBand<BUS>(orientation, sy, rows, epd_band_bw, epd_band_yellow);
+  }
+  endBands<BUS>();
+}
+
+//=============================================================================
+#endif
@@ -0,0 +1,152 @@
+#ifndef __PACKED_FOR_CFAP104212E00213_H__
+#define __PACKED_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Packed PROGMEM planes
+//
+// Image planes are stored as a run of packed records (tools/pack_images.py
+// writes them from a bmp_to_epaper header):
+//
+//   0x00-0x7F  n: the next n + 1 bytes are copied (1-128 bytes)
+//   0x80-0xFF  n: the next byte is repeated n - 0x80 + 2 times (2-129 bytes)
+//
+// A plane has no end marker, the reader knows its length. The mostly empty
+// yellow plane of the splash screen packs to a third of its size.
+//
+// stream() decodes straight into the SPI stream: literal runs go out in
+// EPD_CHUNK pieces and fill runs as one streamFill(), so a long run of
+// white costs two flash reads. read() and seek() serve rows in any order
+// for partial windows.
+//=============================================================================
+
+struct ePaperUnpacker
+{
+  //Start decoding packed from the first byte of its plane
+  void begin(const uint8_t *packed)
+  {
+    start = packed;
+    src = packed;
+    position = 0;
+    left = 0;
+  }
+
+  //Send the next n bytes of the plane to the controller, which must be
+  //selected with DC high (after BUS::beginCMD())
+  template<class BUS>
+  void stream(uint16_t n)
+  {
+    while (n != 0)
+    {
+      if (left == 0)
+      {
+        nextRun();
+      }
+      uint8_t c = (left < n) ? left : n;
+      if (fill)
+      {
+        BUS::streamFill(value, c);
+      }
+      else
+      {
+        BUS::streamData_Flash(src, c);
+        src += c;
+      }
+      left -= c;
+      position += c;
+      n -= c;
+    }
+  }
+
+  //Copy the next n bytes of the plane to out
+  void read(uint8_t *out, uint16_t n)
+  {
+    while (n != 0)
+    {
+      if (left == 0)
+      {
+        nextRun();
+      }
+      uint8_t c = (left < n) ? left : n;
+      if (fill)
+      {
+        memset(out, value, c);
+      }
+      else
+      {
+        memcpy_P(out, src, c);
+        src += c;
+      }
+      out += c;
+      left -= c;
+      position += c;
+      n -= c;
+    }
+  }
+
+  //Move to byte offset to in the plane. Going back starts over, going
+  //forward steps over whole runs without reading them.
+  void seek(uint16_t to)
+  {
+    if (to < position)
+    {
+      begin(start);
+    }
+    while (position < to)
+    {
+      if (left == 0)
+      {
+        nextRun();
+      }
+      uint8_t c = ((uint16_t)(to - position) < left) ? (to - position) : left;
+      if (!fill)
+      {
+        src += c;
+      }
+      left -= c;
+      position += c;
+    }
+  }
+
+private:
+  void nextRun(void)
+  {
+    uint8_t c = pgm_read_byte(src++);
+    fill = (0 != (c & 0x80));
+    if (fill)
+    {
+      left = (c & 0x7f) + 2;
+      value = pgm_read_byte(src++);
+    }
+    else
+    {
+      left = c + 1;
+    }
+  }
+
+  const uint8_t *start;
+  //next packed byte to read
+  const uint8_t *src;
+  //offset in the plane of the next byte out
+  uint16_t position;
+  //bytes left in the current run
+  uint8_t  left;
+  bool     fill;
+  uint8_t  value;
+};
+
+//Send a whole packed plane of n bytes
+template<class BUS>
+void streamPacked(const uint8_t *packed, uint16_t n)
+{
+  ePaperUnpacker plane;
+  plane.begin(packed);
+  plane.stream<BUS>(n);
+}
+
+//=============================================================================
+#endif
@@ -0,0 +1,309 @@
+#ifndef __PANEL_FOR_CFAP104212E00213_H__
+#define __PANEL_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Panels and the multi-panel scheduler
+//
+// A panel is a type: ePaperPanel<BUS> gathers one controller's bus, job
+// queue (ePaperAsync), LUT state (ePaperLUT) and temperature state
+// (ePaperTemperature), all of it kept per BUS. Several panels on one SPI
+// bus are several typedefs with their own CS, DC, RESET and BUSY pins:
+//
+//   typedef ePaperPanel<ePaperBus<10, 5, 4, 3> > PanelA;
+//   typedef ePaperPanel<ePaperBus< 9, 6, 7, 2> > PanelB;
+//
+// A panel only needs the bus while data is sent. Once a job has started a
+// refresh the panel works on its own for seconds, watched through its BUSY
+// pin, and the bus is free for the next panel. ePaperScheduler services
+// every panel's queue in turn, so while panel A refreshes panel B is
+// loaded and starts its own refresh: N panels take N loads plus about one
+// refresh instead of N refreshes. Each refreshing panel draws its own
+// supply current, so the supply must carry all of them at once.
+//
+// Only panels whose BUSY pin has an external interrupt (D2 and D3 on an
+// Uno) are interrupt driven, the rest are polled from service().
+//=============================================================================
+
+//Panels one scheduler can hold
+#ifndef EPD_MAX_PANELS
+#define EPD_MAX_PANELS (4)
+#endif
+
+//RESET low time and the wait after it, in microseconds. The controller
+//needs far less than the 200 ms each that the sketch used to allow; BUSY
+//then says when it is ready.
+#ifndef EPD_RESET_PULSE_US
+#define EPD_RESET_PULSE_US (100)
+#endif
+#ifndef EPD_RESET_SETTLE_US
+#define EPD_RESET_SETTLE_US (200)
+#endif
+
+//Every register init() sets, apart from Panel Setting (ePaperLUT) and PLL
+//(ePaperTemperature): command, length, data. Deep sleep loses them all,
+//so they are kept here to be sent again. The supply settings go before
+//Power On, the rest after it.
+const uint8_t EPD_POWER_REGISTERS[] PROGMEM =
+{
+  //Power Setting
+  0x01, 5, 0x03, 0x00, 0x2B, 0x2B, 0x03,
+  //Booster Soft Start
+  0x06, 3, 0x17, 0x17, 0x17
+};
+#define EPD_POWER_REGISTER_COUNT (2)
+
+const uint8_t EPD_REGISTERS[] PROGMEM =
+{
+  //Resolution
+  0x61, 3, EPD_HRES, EPD_VRES >> 8, EPD_VRES & 0xff,
+  //VCOM_DC Setting
+  0x82, 1, 0x28,
+  //Vcom and data interval setting
+  0x50, 1, 0x87
+};
+#define EPD_REGISTER_COUNT (3)
+
+//One panel's entry points, for code that handles panels of different types
+struct EPD_PanelOps
+{
+  void (*service)(void);
+  bool (*idle)(void);
+  bool (*submit)(EPD_Job job, void *context, EPD_Callback done);
+};
+
+template<class BUS>
+struct ePaperPanel
+{
+  typedef BUS                    Bus;
+  typedef ePaperAsync<BUS>       Async;
+  typedef ePaperLUT<BUS>         LUT;
+  typedef ePaperTemperature<BUS> Temp;
+
+  //Pins and the BUSY interrupt, before SPI.begin()
+  static void begin(void)
+  {
+    BUS::begin();
+    Async::begin();
+  }
+
+  //Pulse RESET, the controller loses all of its settings. BUSY is low
+  //until it is ready again.
+  static void reset(void)
+  {
+    EPD_TIMED(TIMING_RESET, BUS::cs_pin);
+    BUS::RST::low();
+    delayMicroseconds(EPD_RESET_PULSE_US);
+    BUS::RST::high();
+    delayMicroseconds(EPD_RESET_SETTLE_US);
+    BUS::waitReady();
+  }
+
+  //Send the settings of EPD_POWER_REGISTERS[], ahead of powerOn()
+  static void writePowerRegisters(void)
+  {
+    writeSettings(EPD_POWER_REGISTERS, EPD_POWER_REGISTER_COUNT);
+  }
+
+  //Send the settings of EPD_REGISTERS[], after powerOn()
+  static void writeRegisters(void)
+  {
+    writeSettings(EPD_REGISTERS, EPD_REGISTER_COUNT);
+  }
+
+  //Power On, waiting for the supplies to come up
+  static void powerOn(void)
+  {
+    Async::startBusy(0x04);
+    Async::waitIdle();
+  }
+
+  //Set the controller up for the tri-color waveform after a reset and
+  //power it on, in the order of the datasheet: supplies, Power On, then
+  //the panel, PLL and display settings
+  static void init(void)
+  {
+    //-------------------------------------------------------------------------
+    //more detail on the following commands and additional commands not used
+    //here can be found on the CFAP104212E0-0213 datasheet on the
+    //Crystalfontz website
+    //-------------------------------------------------------------------------
+    writePowerRegisters();
+
+    powerOn();
+
+    //Panel Setting, tri-color waveform from OTP. The controller was just
+    //reset so it holds no register LUTs.
+    LUT::invalidate();
+    LUT::select(LUT_TRICOLOR);
+
+    //PLL Control, picked from the on-chip temperature sensor
+    Temp::invalidate();
+    Temp::apply();
+
+    writeRegisters();
+  }
+
+  //Start a full refresh at the frame rate for the panel's temperature and
+  //return, for the end of a job
+  static void refresh(void)
+  {
+    Temp::apply();
+    Async::refresh();
+  }
+
+  static const EPD_PanelOps &ops(void)
+  {
+    static const EPD_PanelOps panel_ops =
+    {
+      Async::service,
+      Async::idle,
+      Async::submit
+    };
+    return panel_ops;
+  }
+
+private:
+  //count settings from r: command, length, data
+  static void writeSettings(const uint8_t *r, uint8_t count)
+  {
+    for (uint8_t i = 0; i < count; i++)
+    {
+      uint8_t command = pgm_read_byte(r++);
+      uint8_t n = pgm_read_byte(r++);
+      BUS::writeCMDData_Flash(command, r, n);
+      r += n;
+    }
+  }
+};
+
+//=============================================================================
+// Jobs that work on any panel, PANEL is an ePaperPanel
+
+//A full screen packed PROGMEM image pair (see Packed_for_CFAP104212E00213.h)
+struct EPD_PackedImage
+{
+  const uint8_t *bw;
+  const uint8_t *yellow;
+  //ROTATE_0 etc., the planes hold an orientWidth() x orientHeight() image
+  uint8_t orientation;
+};
+
+//Load the EPD_PackedImage at context and start the refresh
+template<class PANEL>
+void packedImageJob(void *context)
+{
+  typedef typename PANEL::Bus BUS;
+  const EPD_PackedImage &image = *(const EPD_PackedImage *)context;
+  if (image.orientation != ROTATE_0)
+  {
+    loadPackedOriented<BUS>(image.orientation, image.bw, image.yellow);
+  }
+  else
+  {
+    ePaperAsync<BUS>::waitReady();
+    {
+      EPD_TIMED(TIMING_PLANE, 0x10);
+      BUS::beginCMD(0x10);
+      streamPacked<BUS>(image.bw, EPD_PLANE_BYTES);
+      BUS::endTransfer();
+    }
+    {
+      EPD_TIMED(TIMING_PLANE, 0x13);
+      BUS::beginCMD(0x13);
+      streamPacked<BUS>(image.yellow, EPD_PLANE_BYTES);
+      BUS::endTransfer();
+    }
+    //Data Stop
+    BUS::writeCMD(0x11);
+  }
+  PANEL::refresh();
+}
+
+//Write the two EPD_Pattern (BW, then yellow) at context and start the
+//refresh
+template<class PANEL>
+void patternJob(void *context)
+{
+  const EPD_Pattern *planes = (const EPD_Pattern *)context;
+  writePatterns<typename PANEL::Bus>(planes[0], planes[1]);
+  PANEL::refresh();
+}
+
+//=============================================================================
+// Round robin over the job queues of several panels
+template<uint8_t MAX_PANELS>
+struct ePaperScheduler
+{
+  const EPD_PanelOps *panel[MAX_PANELS];
+  uint8_t count;
+
+  ePaperScheduler() : count(0) {}
+
+  //Returns the panel's index, or 0xff if the scheduler is full
+  uint8_t add(const EPD_PanelOps &ops)
+  {
+    if (count == MAX_PANELS)
+    {
+      return 0xff;
+    }
+    panel[count] = &ops;
+    return count++;
+  }
+
+  //Queue job on panel i. It runs as soon as that panel is idle, whatever
+  //the others are doing.
+  bool submit(uint8_t i, EPD_Job job, void *context, EPD_Callback done = 0)
+  {
+    if (count <= i)
+    {
+      return false;
+    }
+    return panel[i]->submit(job, context, done);
+  }
+
+  //The same job on every panel, they load one after another and refresh
+  //together. Returns false if any queue was full.
+  bool submitAll(EPD_Job (*job_for)(uint8_t i), void *context, EPD_Callback done = 0)
+  {
+    bool ok = true;
+    for (uint8_t i = 0; i < count; i++)
+    {
+      ok = panel[i]->submit(job_for(i), context, done) && ok;
+    }
+    return ok;
+  }
+
+  //Advance every panel's queue, call as often as possible
+  void service(void)
+  {
+    for (uint8_t i = 0; i < count; i++)
+    {
+      panel[i]->service();
+    }
+  }
+
+  //True when no panel has anything running or queued
+  bool idle(void)
+  {
+    bool all_idle = true;
+    for (uint8_t i = 0; i < count; i++)
+    {
+      //every panel is serviced, not just up to the first busy one
+      all_idle = panel[i]->idle() && all_idle;
+    }
+    return all_idle;
+  }
+
+  void waitIdle(void)
+  {
+    while (!idle());
+  }
+};
+
+//=============================================================================
+#endif
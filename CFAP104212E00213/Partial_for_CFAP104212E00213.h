@@ -0,0 +1,263 @@
+#ifndef __PARTIAL_FOR_CFAP104212E00213_H__
+#define __PARTIAL_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Windowed partial update
+//
+// Drawing code reports the pixels it touched with ePaperDirty::mark(). The
+// marks are kept as a short list of byte-aligned windows, merging any two
+// whenever sending their union costs no more than sending them separately.
+// partialUpdateWindows() then enters partial mode (0x91), writes each window
+// (0x90, 0x10, 0x13) and starts one refresh of the area covering them
+// (0x12). It returns while the panel refreshes; ePaperAsync leaves partial
+// mode (0x92) once the refresh is done.
+//
+// The pixels themselves come from a row source callback, so no frame buffer
+// is needed: it is asked for one row of one plane of one window at a time.
+//=============================================================================
+
+//Most windows tracked before the closest pair is forced to merge
+#ifndef EPD_MAX_DIRTY
+#define EPD_MAX_DIRTY (4)
+#endif
+
+//A 0x90 window costs a command plus 7 bytes of setup, count it as data
+#define EPD_WINDOW_COST (8)
+
+//Byte columns and rows, both inclusive
+struct EPD_Window
+{
+  uint8_t  xb1;
+  uint8_t  xb2;
+  uint16_t y1;
+  uint16_t y2;
+};
+
+//Fill bytes[0..count-1] with the plane (0 = BW, 1 = yellow) data for row y,
+//starting at byte column first_byte.
+typedef void (*EPD_RowSource)(uint8_t plane, uint16_t y, uint8_t first_byte,
+                              uint8_t count, uint8_t *bytes, void *context);
+
+//Bytes of plane data a window carries
+static inline uint16_t windowBytes(const EPD_Window &w)
+{
+  return (uint16_t)(w.xb2 - w.xb1 + 1) * (w.y2 - w.y1 + 1);
+}
+
+static inline EPD_Window windowUnion(const EPD_Window &a, const EPD_Window &b)
+{
+  EPD_Window u;
+  u.xb1 = (a.xb1 < b.xb1) ? a.xb1 : b.xb1;
+  u.xb2 = (a.xb2 > b.xb2) ? a.xb2 : b.xb2;
+  u.y1 = (a.y1 < b.y1) ? a.y1 : b.y1;
+  u.y2 = (a.y2 > b.y2) ? a.y2 : b.y2;
+  return u;
+}
+
+//=============================================================================
+struct ePaperDirty
+{
+  EPD_Window window[EPD_MAX_DIRTY];
+  uint8_t    count;
+
+  ePaperDirty() : count(0) {}
+
+  void clear(void) { count = 0; }
+
+  //Record that pixels x1..x2, y1..y2 (inclusive, on the panel) changed.
+  //The corners may come in either order. The rectangle is clipped to the
+  //panel, and ignored if none of it is on the panel.
+  void mark(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+  {
+    if (x2 < x1) { int16_t t = x1; x1 = x2; x2 = t; }
+    if (y2 < y1) { int16_t t = y1; y1 = y2; y2 = t; }
+    if ((x2 < 0) || (y2 < 0) || (EPD_HRES <= x1) || (EPD_VRES <= y1))
+    {
+      return;
+    }
+    if (x1 < 0) { x1 = 0; }
+    if (y1 < 0) { y1 = 0; }
+    if (EPD_HRES <= x2) { x2 = EPD_HRES - 1; }
+    if (EPD_VRES <= y2) { y2 = EPD_VRES - 1; }
+    if (count == EPD_MAX_DIRTY)
+    {
+      mergeClosest();
+    }
+    window[count].xb1 = x1 >> 3;
+    window[count].xb2 = x2 >> 3;
+    window[count].y1 = y1;
+    window[count].y2 = y2;
+    count++;
+    //Keep folding until no pair is cheaper sent together
+    while (mergeCheapest());
+  }
+
+  //Smallest window holding every dirty window
+  EPD_Window bounds(void) const
+  {
+    EPD_Window b = window[0];
+    for (uint8_t i = 1; i < count; i++)
+    {
+      b = windowUnion(b, window[i]);
+    }
+    return b;
+  }
+
+private:
+  void remove(uint8_t i)
+  {
+    count--;
+    window[i] = window[count];
+  }
+
+  //Merge the first pair whose union is no more expensive than the two apart
+  bool mergeCheapest(void)
+  {
+    for (uint8_t i = 0; i < count; i++)
+    {
+      for (uint8_t j = i + 1; j < count; j++)
+      {
+        EPD_Window u = windowUnion(window[i], window[j]);
+        if (windowBytes(u) <= windowBytes(window[i]) + windowBytes(window[j]) + EPD_WINDOW_COST)
+        {
+          window[i] = u;
+          remove(j);
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  //Out of slots: merge the pair that grows the least
+  void mergeClosest(void)
+  {
+    uint8_t best_i = 0;
+    uint8_t best_j = 1;
+    int32_t best_growth = 0x7fffffff;
+    for (uint8_t i = 0; i < count; i++)
+    {
+      for (uint8_t j = i + 1; j < count; j++)
+      {
+        int32_t growth = (int32_t)windowBytes(windowUnion(window[i], window[j])) -
+                         windowBytes(window[i]) - windowBytes(window[j]);
+        if (growth < best_growth)
+        {
+          best_growth = growth;
+          best_i = i;
+          best_j = j;
+        }
+      }
+    }
+    window[best_i] = windowUnion(window[best_i], window[best_j]);
+    remove(best_j);
+  }
+};
+
+//=============================================================================
+//Partial Window (PTL) (R90H), pixel x is HRST[7:3], the end is HRED[7:3]|111
+template<class BUS>
+void setPartialWindow(const EPD_Window &w)
+{
+  const uint8_t ptl[] =
+  {
+    (uint8_t)(w.xb1 << 3),
+    (uint8_t)((w.xb2 << 3) | 0x07),
+    (uint8_t)(w.y1 >> 8),
+    (uint8_t)(w.y1 & 0xff),
+    (uint8_t)(w.y2 >> 8),
+    (uint8_t)(w.y2 & 0xff),
+    0x01
+  };
+  BUS::writeCMDData(0x90, ptl, sizeof(ptl));
+}
+
+//Stream one plane of a window, one row per source call
+template<class BUS>
+void sendWindowPlane(const EPD_Window &w, uint8_t plane,
+                     EPD_RowSource source, void *context)
+{
+  uint8_t row[EPD_ROW_BYTES];
+  uint8_t n = w.xb2 - w.xb1 + 1;
+  BUS::beginCMD(plane ? 0x13 : 0x10);
+  for (uint16_t y = w.y1; y <= w.y2; y++)
+  {
+    source(plane, y, w.xb1, n, row, context);
+    BUS::streamBuffer(row, n);
+  }
+  BUS::endTransfer();
+}
+
+//Write every dirty window and start one partial refresh of them, without
+//waiting for it
+template<class BUS>
+void partialUpdateWindows(ePaperDirty &dirty, EPD_RowSource source, void *context)
+{
+  if (dirty.count == 0)
+  {
+    return;
+  }
+  ePaperAsync<BUS>::waitReady();
+  //turn on partial update mode
+  BUS::writeCMD(0x91);
+  for (uint8_t i = 0; i < dirty.count; i++)
+  {
+    EPD_TIMED(TIMING_WINDOW, i);
+    setPartialWindow<BUS>(dirty.window[i]);
+    sendWindowPlane<BUS>(dirty.window[i], 0, source, context);
+    sendWindowPlane<BUS>(dirty.window[i], 1, source, context);
+  }
+  //refresh the area covering all of the windows at once
+  if (1 < dirty.count)
+  {
+    setPartialWindow<BUS>(dirty.bounds());
+  }
+  ePaperAsync<BUS>::partialRefresh();
+  dirty.clear();
+}
+
+//=============================================================================
+// Banded writes
+//
+// A band is a run of full width rows. Each band is written through its own
+// partial window so the two planes of one band can be sent back to back,
+// without holding either full plane in RAM. Nothing is refreshed: call
+// beginBands(), writeBand() as often as needed in any order, endBands(), then
+// refresh the whole panel with 0x12.
+template<class BUS>
+void beginBands(void)
+{
+  ePaperAsync<BUS>::waitReady();
+  //turn on partial update mode
+  BUS::writeCMD(0x91);
+}
+
+//rows rows starting at y, EPD_ROW_BYTES per row in each plane
+template<class BUS>
+void writeBand(uint16_t y, uint8_t rows, const uint8_t *bw, const uint8_t *yellow)
+{
+  EPD_TIMED(TIMING_WINDOW, y);
+  EPD_Window w;
+  w.xb1 = 0;
+  w.xb2 = EPD_ROW_BYTES - 1;
+  w.y1 = y;
+  w.y2 = y + rows - 1;
+  setPartialWindow<BUS>(w);
+  BUS::writeCMDData(0x10, bw, (uint16_t)rows * EPD_ROW_BYTES);
+  BUS::writeCMDData(0x13, yellow, (uint16_t)rows * EPD_ROW_BYTES);
+}
+
+template<class BUS>
+void endBands(void)
+{
+  //turn off partial update mode
+  BUS::writeCMD(0x92);
+}
+
+//=============================================================================
+#endif
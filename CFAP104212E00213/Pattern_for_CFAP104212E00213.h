@@ -0,0 +1,176 @@
+#ifndef __PATTERN_FOR_CFAP104212E00213_H__
+#define __PATTERN_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Procedural patterns
+//
+// A plane full of a regular pattern (clearing, burn-in and test cycles) is
+// described by a 6 byte EPD_Pattern instead of image data, and each row is
+// made on the fly as it is streamed. writePattern() sends a whole plane
+// under one chip select; patternRowSource() feeds partialUpdateWindows() so
+// a pattern can also fill a window.
+//
+// Rows are built a byte at a time against the compile time panel geometry,
+// and a solid plane is a single streamFill().
+//=============================================================================
+
+#define PATTERN_SOLID    (0) //every byte = invert
+#define PATTERN_CHECKER  (1) //size x size pixel cells
+#define PATTERN_HSTRIPES (2) //size rows on, size rows off
+#define PATTERN_VSTRIPES (3) //size columns on, size columns off
+#define PATTERN_GRADIENT (4) //0% on at the left to 100% at the right,
+                             //4x4 ordered dither
+#define PATTERN_TILE     (5) //8x8 PROGMEM tile, one byte per row
+
+struct EPD_Pattern
+{
+  uint8_t kind;
+  //cell or stripe size in pixels, 1-255
+  uint8_t size;
+  //XORed into every byte: 0x00 as described, 0xff inverted
+  uint8_t invert;
+  const uint8_t *tile;
+};
+
+static inline EPD_Pattern solidPattern(uint8_t value)
+{
+  EPD_Pattern p = { PATTERN_SOLID, 1, value, 0 };
+  return p;
+}
+
+//A size of 0 is taken as 1
+static inline EPD_Pattern makePattern(uint8_t kind, uint8_t size, bool inverted = false)
+{
+  EPD_Pattern p = { kind, (uint8_t)(size ? size : 1), (uint8_t)(inverted ? 0xff : 0x00), 0 };
+  return p;
+}
+
+static inline EPD_Pattern tilePattern(const uint8_t *tile, bool inverted = false)
+{
+  EPD_Pattern p = { PATTERN_TILE, 8, (uint8_t)(inverted ? 0xff : 0x00), tile };
+  return p;
+}
+
+//Byte of pixels x..x+7 where a pixel is on if ((x + offset) / size) is odd
+static inline uint8_t patternBits(uint8_t x, uint8_t offset, uint8_t size)
+{
+  uint8_t bits = 0;
+  uint16_t cell_x = x + offset;
+  for (uint8_t bit = 0; bit < 8; bit++)
+  {
+    bits = (bits << 1) | ((cell_x / size) & 1);
+    cell_x++;
+  }
+  return bits;
+}
+
+//Make row y of the pattern, EPD_ROW_BYTES bytes
+void patternRow(const EPD_Pattern &p, uint16_t y, uint8_t *row)
+{
+  switch (p.kind)
+  {
+    case PATTERN_SOLID:
+      memset(row, p.invert, EPD_ROW_BYTES);
+      return;
+    case PATTERN_HSTRIPES:
+      memset(row, ((y / p.size) & 1) ? ~p.invert : p.invert, EPD_ROW_BYTES);
+      return;
+    case PATTERN_TILE:
+      memset(row, pgm_read_byte(&p.tile[y & 7]) ^ p.invert, EPD_ROW_BYTES);
+      return;
+    case PATTERN_CHECKER:
+    case PATTERN_VSTRIPES:
+    {
+      //a checker row is a vertical stripe shifted by a cell on odd cell rows
+      uint8_t offset = 0;
+      if ((p.kind == PATTERN_CHECKER) && ((y / p.size) & 1))
+      {
+        offset = p.size;
+      }
+      if ((p.size & 7) == 0)
+      {
+        //whole byte cells
+        uint8_t cells = p.size >> 3;
+        for (uint8_t i = 0; i < EPD_ROW_BYTES; i++)
+        {
+          row[i] = ((((i + (offset >> 3)) / cells) & 1) ? 0xff : 0x00) ^ p.invert;
+        }
+      }
+      else
+      {
+        for (uint8_t i = 0; i < EPD_ROW_BYTES; i++)
+        {
+          row[i] = patternBits(i << 3, offset, p.size) ^ p.invert;
+        }
+      }
+      return;
+    }
+    case PATTERN_GRADIENT:
+    {
+      //pixel is on when its level is above its BAYER4 entry
+      const uint8_t *thresholds = &BAYER4[(y & 3) << 2];
+      for (uint8_t i = 0; i < EPD_ROW_BYTES; i++)
+      {
+        uint8_t bits = 0;
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+          uint8_t x = (i << 3) + bit;
+          //0 at the left edge to 16 at the right
+          uint8_t level = ((uint16_t)x * 17) / EPD_HRES;
+          bits = (bits << 1) | (pgm_read_byte(&thresholds[x & 3]) < level);
+        }
+        row[i] = bits ^ p.invert;
+      }
+      return;
+    }
+  }
+}
+
+//Send a whole plane of the pattern, plane 0 = BW (0x10), 1 = yellow (0x13)
+template<class BUS>
+void writePattern(uint8_t plane, const EPD_Pattern &p)
+{
+  uint8_t command = plane ? 0x13 : 0x10;
+  EPD_TIMED(TIMING_PLANE, command);
+  if (p.kind == PATTERN_SOLID)
+  {
+    BUS::writeCMDFill(command, p.invert, EPD_PLANE_BYTES);
+    return;
+  }
+  uint8_t row[EPD_ROW_BYTES];
+  BUS::beginCMD(command);
+  for (uint16_t y = 0; y < EPD_VRES; y++)
+  {
+    //streamBuffer() overwrites the row, so it is made again each time
+    patternRow(p, y, row);
+    BUS::streamBuffer(row, EPD_ROW_BYTES);
+  }
+  BUS::endTransfer();
+}
+
+//Both planes, then the caller refreshes
+template<class BUS>
+void writePatterns(const EPD_Pattern &bw, const EPD_Pattern &yellow)
+{
+  ePaperAsync<BUS>::waitReady();
+  writePattern<BUS>(0, bw);
+  writePattern<BUS>(1, yellow);
+}
+
+//Row source for partialUpdateWindows(), context points at two EPD_Pattern,
+//BW then yellow
+void patternRowSource(uint8_t plane, uint16_t y, uint8_t first_byte,
+                      uint8_t n, uint8_t *bytes, void *context)
+{
+  uint8_t row[EPD_ROW_BYTES];
+  patternRow(((const EPD_Pattern *)context)[plane], y, row);
+  memcpy(bytes, row + first_byte, n);
+}
+
+//=============================================================================
+#endif
@@ -0,0 +1,158 @@
+#ifndef __POWER_FOR_CFAP104212E00213_H__
+#define __POWER_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Power management between updates
+//
+// An ePaper image stays without power, so between updates both the panel
+// and the MCU can be shut down:
+//
+//   powerOff()   Power Off (0x02): the charge pumps stop. The controller
+//                keeps its registers, LUTs and image RAM, so wake() only
+//                sends Power On (0x04).
+//   deepSleep()  Power Off, then Deep Sleep (0x07, 0xA5): the lowest
+//                current, but only a reset wakes the controller and it
+//                loses everything. wake() resets it with the short pulse of
+//                ePaperPanel::reset() and sets it up again in the order
+//                init() uses: EPD_POWER_REGISTERS[], Power On, the waveform
+//                profile selected (register LUTs are only uploaded if that
+//                profile has them), PLL and EPD_REGISTERS[].
+//   sleepMCU()   The ATmega in power down, woken by the watchdog.
+//
+// Nothing is sent to a panel that is already in the state asked for.
+//=============================================================================
+#ifdef __AVR__
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+#endif
+
+#define POWER_ON    (0)
+#define POWER_OFF   (1)
+#define POWER_SLEEP (2)
+
+template<class PANEL>
+struct ePaperPower
+{
+  typedef typename PANEL::Bus BUS;
+
+  //POWER_ON, POWER_OFF or POWER_SLEEP
+  static inline uint8_t state(void) { return power_state; }
+
+  //Stop the charge pumps once the panel is idle
+  static void powerOff(void)
+  {
+    if (power_state != POWER_ON)
+    {
+      return;
+    }
+    PANEL::Async::waitIdle();
+    PANEL::Async::startBusy(0x02);
+    PANEL::Async::waitIdle();
+    power_state = POWER_OFF;
+  }
+
+  //Power off and put the controller into deep sleep
+  static void deepSleep(void)
+  {
+    if (power_state == POWER_SLEEP)
+    {
+      return;
+    }
+    powerOff();
+    //the profile is put back on wake
+    profile = PANEL::LUT::selected();
+    //Deep Sleep, with its check code
+    BUS::writeCMDFill(0x07, 0xA5, 1);
+    PANEL::LUT::invalidate();
+    PANEL::Temp::invalidate();
+    power_state = POWER_SLEEP;
+  }
+
+  //Back to POWER_ON, ready for an update
+  static void wake(void)
+  {
+    if (power_state == POWER_ON)
+    {
+      return;
+    }
+    if (power_state == POWER_SLEEP)
+    {
+      PANEL::reset();
+      PANEL::writePowerRegisters();
+      PANEL::powerOn();
+      PANEL::LUT::select((profile == 0xff) ? LUT_TRICOLOR : profile);
+      PANEL::Temp::apply();
+      PANEL::writeRegisters();
+    }
+    else
+    {
+      PANEL::powerOn();
+      //PLL again if the temperature band moved while off
+      PANEL::Temp::apply();
+    }
+    power_state = POWER_ON;
+  }
+
+  //Power the MCU down for about seconds (the watchdog is only accurate to
+  //10% or so). millis() stands still meanwhile, so the temperature is
+  //measured again before the next refresh. The panel should be off or
+  //asleep first. Other boards just wait.
+  static void sleepMCU(uint16_t seconds)
+  {
+#ifdef __AVR__
+    //the ADC would keep drawing current in power down
+    uint8_t adcsra = ADCSRA;
+    ADCSRA &= ~_BV(ADEN);
+    while (seconds != 0)
+    {
+      //8 s steps, then 1 s steps
+      uint8_t step = (8 <= seconds) ? 8 : 1;
+      watchdogSleep((step == 8) ? (_BV(WDP3) | _BV(WDP0)) : (_BV(WDP2) | _BV(WDP1)));
+      seconds -= step;
+    }
+    ADCSRA = adcsra;
+#else
+    delay((uint32_t)seconds * 1000UL);
+#endif
+    PANEL::Temp::expire();
+  }
+
+private:
+#ifdef __AVR__
+  //One watchdog period in power down, prescaler bits in wdp
+  static void watchdogSleep(uint8_t wdp)
+  {
+    cli();
+    wdt_reset();
+    MCUSR &= ~_BV(WDRF);
+    //timed sequence: interrupt only, no reset
+    WDTCSR = _BV(WDCE) | _BV(WDE);
+    WDTCSR = _BV(WDIE) | wdp;
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleep_enable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+    wdt_disable();
+  }
+#endif
+
+  static uint8_t power_state;
+  static uint8_t profile;
+};
+
+template<class PANEL> uint8_t ePaperPower<PANEL>::power_state = POWER_ON;
+template<class PANEL> uint8_t ePaperPower<PANEL>::profile = 0xff;
+
+#ifdef __AVR__
+//The watchdog only wakes sleepMCU()
+EMPTY_INTERRUPT(WDT_vect);
+#endif
+
+//=============================================================================
+#endif
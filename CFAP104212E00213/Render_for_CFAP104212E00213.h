@@ -0,0 +1,546 @@
+#ifndef __RENDER_FOR_CFAP104212E00213_H__
+#define __RENDER_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Banded rendering
+//
+// A full frame is 2 x 2756 bytes, more than an Uno has. Instead, drawing
+// calls are kept in a display list (ePaperCanvas) and the frame is
+// rasterized a few rows at a time into the band buffers the image decoders
+// share (epd_band_bw and epd_band_yellow, see Orient_for_CFAP104212E00213.h)
+// and written straight to the controller (see writeBand()). Each row is
+// rasterized once, into both planes.
+//
+// Every drawing call also marks its area in the canvas' ePaperDirty, and
+// renderDirty() sends just those windows as a partial update without
+// rendering the whole frame.
+//
+// Coordinates are in the canvas' orientation (see setOrientation()) and
+// are turned into panel coordinates as items are added.
+//
+// Text items are rasterized with textRow() from Text_for_CFAP104212E00213.h.
+//=============================================================================
+
+//Display list entry kinds
+#define ITEM_FILL   (0) //filled rectangle x0,y0 - x1,y1
+#define ITEM_FRAME  (1) //1 pixel rectangle outline x0,y0 - x1,y1
+#define ITEM_LINE   (2) //line from x0,y0 to x1,y1
+#define ITEM_BITMAP (3) //PROGMEM 1bpp bitmap at x0,y0, x1 wide, y1 high
+#define ITEM_TEXT   (4) //string in font with its top left at x0,y0, x1
+                        //wide, y1 high
+
+struct EPD_Item
+{
+  uint8_t type;
+  uint8_t color;
+  //bitmaps and text keep their own coordinates and are turned as they are
+  //drawn
+  uint8_t orientation;
+  int16_t x0;
+  int16_t y0;
+  int16_t x1;
+  int16_t y1;
+  const uint8_t *data;
+  const EPD_Font *font;
+};
+
+//Time spent in the last renderBands() call, in microseconds
+struct EPD_RenderStats
+{
+  uint8_t  bands;
+  uint32_t raster_us;
+  uint32_t send_us;
+};
+
+//=============================================================================
+// Row helpers, a row is EPD_ROW_BYTES bytes, MSB is the leftmost pixel
+
+//Set pixels x0..x1 (inclusive, already clipped) in row
+static void setSpan(uint8_t *row, int16_t x0, int16_t x1)
+{
+  uint8_t first = x0 >> 3;
+  uint8_t last = x1 >> 3;
+  uint8_t first_mask = 0xff >> (x0 & 7);
+  uint8_t last_mask = 0xff << (7 - (x1 & 7));
+  if (first == last)
+  {
+    row[first] |= first_mask & last_mask;
+    return;
+  }
+  row[first] |= first_mask;
+  for (uint8_t i = first + 1; i < last; i++)
+  {
+    row[i] = 0xff;
+  }
+  row[last] |= last_mask;
+}
+
+//Clear pixels x0..x1 (inclusive, already clipped) in row
+static void clearSpan(uint8_t *row, int16_t x0, int16_t x1)
+{
+  uint8_t first = x0 >> 3;
+  uint8_t last = x1 >> 3;
+  uint8_t first_mask = 0xff >> (x0 & 7);
+  uint8_t last_mask = 0xff << (7 - (x1 & 7));
+  if (first == last)
+  {
+    row[first] &= ~(first_mask & last_mask);
+    return;
+  }
+  row[first] &= ~first_mask;
+  for (uint8_t i = first + 1; i < last; i++)
+  {
+    row[i] = 0x00;
+  }
+  row[last] &= ~last_mask;
+}
+
+//Paint pixels x0..x1 of both plane rows in color, clipping to the panel
+static void paintSpan(uint8_t *bw, uint8_t *yellow, int16_t x0, int16_t x1, uint8_t color)
+{
+  if (x1 < x0)
+  {
+    int16_t t = x0;
+    x0 = x1;
+    x1 = t;
+  }
+  if ((x1 < 0) || (EPD_HRES <= x0))
+  {
+    return;
+  }
+  if (x0 < 0)
+  {
+    x0 = 0;
+  }
+  if (EPD_HRES <= x1)
+  {
+    x1 = EPD_HRES - 1;
+  }
+  if (color == EPD_BLACK)
+  {
+    setSpan(bw, x0, x1);
+    clearSpan(yellow, x0, x1);
+  }
+  else if (color == EPD_YELLOW)
+  {
+    clearSpan(bw, x0, x1);
+    setSpan(yellow, x0, x1);
+  }
+  else
+  {
+    clearSpan(bw, x0, x1);
+    clearSpan(yellow, x0, x1);
+  }
+}
+
+//Paint the set bits of one byte of a bitmap, leftmost pixel at x
+static void paintBits(uint8_t *bw, uint8_t *yellow, int16_t x, uint8_t bits, uint8_t color)
+{
+  while (bits != 0)
+  {
+    //find the next run of set bits
+    uint8_t start = 0;
+    while (!(bits & (0x80 >> start)))
+    {
+      start++;
+    }
+    uint8_t end = start;
+    while ((end < 7) && (bits & (0x80 >> (end + 1))))
+    {
+      end++;
+    }
+    paintSpan(bw, yellow, x + start, x + end, color);
+    bits &= 0xff >> (end + 1);
+  }
+}
+
+//=============================================================================
+template<uint8_t MAX_ITEMS>
+struct ePaperCanvas
+{
+  EPD_Item    item[MAX_ITEMS];
+  uint8_t     count;
+  //Areas changed since the last render or partial update
+  ePaperDirty dirty;
+
+  ePaperCanvas() : count(0), orientation(ROTATE_0), text_font(0) {}
+
+  //Orientation of the coordinates of the items added after this, one of
+  //ROTATE_0/90/180/270 and the ORIENT_ flags. Drawing space is then
+  //orientWidth() x orientHeight().
+  void setOrientation(uint8_t o)
+  {
+    orientation = o;
+  }
+
+  //Drop every item, the whole panel becomes white
+  void clear(void)
+  {
+    count = 0;
+    dirty.clear();
+    dirty.mark(0, 0, EPD_HRES - 1, EPD_VRES - 1);
+  }
+
+  bool fillRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color)
+  {
+    return add(ITEM_FILL, color, x0, y0, x1, y1, 0);
+  }
+
+  bool frameRect(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color)
+  {
+    return add(ITEM_FRAME, color, x0, y0, x1, y1, 0);
+  }
+
+  bool line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t color)
+  {
+    return add(ITEM_LINE, color, x0, y0, x1, y1, 0);
+  }
+
+  //bits is a PROGMEM 1bpp image, rows padded to whole bytes; 1 = color,
+  //0 = transparent
+  bool bitmap(int16_t x, int16_t y, int16_t width, int16_t height,
+              const uint8_t *bits, uint8_t color)
+  {
+    return add(ITEM_BITMAP, color, x, y, width, height, bits);
+  }
+
+  //s is kept, not copied: it must stay valid until the canvas is drawn
+  bool text(int16_t x, int16_t y, const char *s, const EPD_Font &font, uint8_t color)
+  {
+    text_font = &font;
+    return add(ITEM_TEXT, color, x, y, textWidth(font, s), font.height,
+               (const uint8_t *)s);
+  }
+
+  //Rasterize display row y into both plane rows, later items on top
+  void rasterRow(uint16_t y, uint8_t *bw, uint8_t *yellow) const
+  {
+    memset(bw, 0x00, EPD_ROW_BYTES);
+    memset(yellow, 0x00, EPD_ROW_BYTES);
+    for (uint8_t i = 0; i < count; i++)
+    {
+      const EPD_Item &it = item[i];
+      switch (it.type)
+      {
+        case ITEM_FILL:
+          if ((it.y0 <= (int16_t)y) && ((int16_t)y <= it.y1))
+          {
+            paintSpan(bw, yellow, it.x0, it.x1, it.color);
+          }
+          break;
+        case ITEM_FRAME:
+          if ((it.y0 == (int16_t)y) || (it.y1 == (int16_t)y))
+          {
+            paintSpan(bw, yellow, it.x0, it.x1, it.color);
+          }
+          else if ((it.y0 < (int16_t)y) && ((int16_t)y < it.y1))
+          {
+            paintSpan(bw, yellow, it.x0, it.x0, it.color);
+            paintSpan(bw, yellow, it.x1, it.x1, it.color);
+          }
+          break;
+        case ITEM_LINE:
+          lineRow(it, y, bw, yellow);
+          break;
+        case ITEM_BITMAP:
+          bitmapRow(it, y, bw, yellow);
+          break;
+        case ITEM_TEXT:
+          textItemRow(it, y, bw, yellow);
+          break;
+      }
+    }
+  }
+
+private:
+  uint8_t orientation;
+  //font of the text item being added
+  const EPD_Font *text_font;
+
+  bool add(uint8_t type, uint8_t color, int16_t x0, int16_t y0,
+           int16_t x1, int16_t y1, const uint8_t *data)
+  {
+    if (count == MAX_ITEMS)
+    {
+      return false;
+    }
+    bool boxed = (type == ITEM_BITMAP) || (type == ITEM_TEXT);
+    if (!boxed)
+    {
+      orientPoint(orientation, x0, y0);
+      orientPoint(orientation, x1, y1);
+    }
+    if ((type == ITEM_FILL) || (type == ITEM_FRAME))
+    {
+      //keep rectangles top left to bottom right
+      if (x1 < x0) { int16_t t = x0; x0 = x1; x1 = t; }
+      if (y1 < y0) { int16_t t = y0; y0 = y1; y1 = t; }
+    }
+    EPD_Item &it = item[count++];
+    it.type = type;
+    it.color = color;
+    it.orientation = boxed ? orientation : ROTATE_0;
+    it.x0 = x0;
+    it.y0 = y0;
+    it.x1 = x1;
+    it.y1 = y1;
+    it.data = data;
+    it.font = (type == ITEM_TEXT) ? text_font : 0;
+    //bounding box, mark() clips it to the panel
+    if (boxed)
+    {
+      int16_t bx0, by0, bx1, by1;
+      bitmapBox(it, bx0, by0, bx1, by1);
+      dirty.mark(bx0, by0, bx1, by1);
+    }
+    else
+    {
+      dirty.mark(x0, y0, x1, y1);
+    }
+    return true;
+  }
+
+  //The span of x a line covers on row y: from where it crosses y - 1/2 to
+  //where it crosses y + 1/2, limited to its own ends
+  static void lineRow(const EPD_Item &it, int16_t y, uint8_t *bw, uint8_t *yellow)
+  {
+    int16_t ymin = (it.y0 < it.y1) ? it.y0 : it.y1;
+    int16_t ymax = (it.y0 < it.y1) ? it.y1 : it.y0;
+    if ((y < ymin) || (ymax < y))
+    {
+      return;
+    }
+    int16_t dy = it.y1 - it.y0;
+    if (dy == 0)
+    {
+      paintSpan(bw, yellow, it.x0, it.x1, it.color);
+      return;
+    }
+    int32_t dx = it.x1 - it.x0;
+    int32_t t2 = 2 * (int32_t)(y - it.y0);
+    int16_t xa = it.x0 + (dx * (t2 - 1)) / (2 * dy);
+    int16_t xb = it.x0 + (dx * (t2 + 1)) / (2 * dy);
+    int16_t xmin = (it.x0 < it.x1) ? it.x0 : it.x1;
+    int16_t xmax = (it.x0 < it.x1) ? it.x1 : it.x0;
+    if (xb < xa) { int16_t t = xa; xa = xb; xb = t; }
+    if (xa < xmin) xa = xmin;
+    if (xmax < xb) xb = xmax;
+    //steep lines cover one pixel per row
+    if (xb < xa) xb = xa;
+    paintSpan(bw, yellow, xa, xb, it.color);
+  }
+
+  //Panel area a bitmap or text item covers
+  static void bitmapBox(const EPD_Item &it, int16_t &bx0, int16_t &by0,
+                        int16_t &bx1, int16_t &by1)
+  {
+    bx0 = it.x0;
+    by0 = it.y0;
+    bx1 = it.x0 + it.x1 - 1;
+    by1 = it.y0 + it.y1 - 1;
+    orientPoint(it.orientation, bx0, by0);
+    orientPoint(it.orientation, bx1, by1);
+    if (bx1 < bx0) { int16_t t = bx0; bx0 = bx1; bx1 = t; }
+    if (by1 < by0) { int16_t t = by0; by0 = by1; by1 = t; }
+  }
+
+  //A turned bitmap is sampled a pixel at a time
+  static void orientedBitmapRow(const EPD_Item &it, int16_t y, uint8_t *bw, uint8_t *yellow)
+  {
+    int16_t bx0, by0, bx1, by1;
+    bitmapBox(it, bx0, by0, bx1, by1);
+    if ((y < by0) || (by1 < y))
+    {
+      return;
+    }
+    if (bx0 < 0)
+    {
+      bx0 = 0;
+    }
+    if (EPD_HRES <= bx1)
+    {
+      bx1 = EPD_HRES - 1;
+    }
+    uint8_t width_bytes = (it.x1 + 7) >> 3;
+    for (int16_t x = bx0; x <= bx1; x++)
+    {
+      int16_t u = x;
+      int16_t v = y;
+      unorientPoint(it.orientation, u, v);
+      u -= it.x0;
+      v -= it.y0;
+      uint8_t bits = pgm_read_byte(&it.data[(uint16_t)v * width_bytes + (u >> 3)]);
+      if (bits & (0x80 >> (u & 7)))
+      {
+        paintSpan(bw, yellow, x, x, it.color);
+      }
+    }
+  }
+
+  static void bitmapRow(const EPD_Item &it, int16_t y, uint8_t *bw, uint8_t *yellow)
+  {
+    if (it.orientation != ROTATE_0)
+    {
+      orientedBitmapRow(it, y, bw, yellow);
+      return;
+    }
+    int16_t r = y - it.y0;
+    if ((r < 0) || (it.y1 <= r))
+    {
+      return;
+    }
+    uint8_t width_bytes = (it.x1 + 7) >> 3;
+    const uint8_t *src = it.data + (uint16_t)r * width_bytes;
+    for (uint8_t i = 0; i < width_bytes; i++)
+    {
+      uint8_t bits = pgm_read_byte(&src[i]);
+      //mask off padding past the bitmap's width
+      if ((i == width_bytes - 1) && (it.x1 & 7))
+      {
+        bits &= 0xff << (8 - (it.x1 & 7));
+      }
+      paintBits(bw, yellow, it.x0 + (i << 3), bits, it.color);
+    }
+  }
+
+  static void textItemRow(const EPD_Item &it, int16_t y, uint8_t *bw, uint8_t *yellow)
+  {
+    const char *s = (const char *)it.data;
+    if (it.orientation == ROTATE_0)
+    {
+      int16_t r = y - it.y0;
+      if ((r < 0) || (it.y1 <= r))
+      {
+        return;
+      }
+      //the glyphs make a mask row, painted a byte at a time
+      uint8_t mask[EPD_ROW_BYTES];
+      memset(mask, 0x00, EPD_ROW_BYTES);
+      textRow(*it.font, s, it.x0, r, mask);
+      for (uint8_t i = 0; i < EPD_ROW_BYTES; i++)
+      {
+        if (mask[i])
+        {
+          paintBits(bw, yellow, i << 3, mask[i], it.color);
+        }
+      }
+      return;
+    }
+    //turned text is sampled a pixel at a time
+    int16_t bx0, by0, bx1, by1;
+    bitmapBox(it, bx0, by0, bx1, by1);
+    if ((y < by0) || (by1 < y))
+    {
+      return;
+    }
+    for (int16_t x = (bx0 < 0) ? 0 : bx0; (x <= bx1) && (x < EPD_HRES); x++)
+    {
+      int16_t u = x;
+      int16_t v = y;
+      unorientPoint(it.orientation, u, v);
+      if (textPixel(*it.font, s, u - it.x0, v - it.y0))
+      {
+        paintSpan(bw, yellow, x, x, it.color);
+      }
+    }
+  }
+};
+
+//=============================================================================
+//Panel rows the shared band buffers hold
+#define EPD_RENDER_ROWS ((uint8_t)(sizeof(epd_band_bw) / EPD_ROW_BYTES))
+
+//Render the whole canvas into the controller's RAM, EPD_RENDER_ROWS rows at
+//a time. The panel is not refreshed. stats, if given, gets the time split.
+template<class BUS, uint8_t MAX_ITEMS>
+void renderBands(ePaperCanvas<MAX_ITEMS> &canvas, EPD_RenderStats *stats = 0)
+{
+  uint32_t raster_us = 0;
+  uint32_t send_us = 0;
+  uint8_t bands = 0;
+
+  beginBands<BUS>();
+  for (uint16_t y = 0; y < EPD_VRES; y += EPD_RENDER_ROWS)
+  {
+    uint8_t rows = (EPD_VRES - y < EPD_RENDER_ROWS) ? (EPD_VRES - y) : EPD_RENDER_ROWS;
+    uint32_t start = micros();
+    for (uint8_t r = 0; r < rows; r++)
+    {
+      canvas.rasterRow(y + r, &epd_band_bw[r * EPD_ROW_BYTES], &epd_band_yellow[r * EPD_ROW_BYTES]);
+    }
+    uint32_t rastered = micros();
+    writeBand<BUS>(y, rows, epd_band_bw, epd_band_yellow);
+    send_us += micros() - rastered;
+    raster_us += rastered - start;
+    bands++;
+  }
+  endBands<BUS>();
+  canvas.dirty.clear();
+
+  if (stats)
+  {
+    stats->bands = bands;
+    stats->raster_us = raster_us;
+    stats->send_us = send_us;
+  }
+}
+
+//Send the canvas' dirty windows and start one partial refresh of them,
+//without waiting for it (see partialUpdateWindows()). A window is sent in
+//bands of as many of its rows as the band buffers hold, each row rasterized
+//once.
+template<class BUS, uint8_t MAX_ITEMS>
+void renderDirty(ePaperCanvas<MAX_ITEMS> &canvas)
+{
+  ePaperDirty &dirty = canvas.dirty;
+  if (dirty.count == 0)
+  {
+    return;
+  }
+  uint8_t bw[EPD_ROW_BYTES];
+  uint8_t yellow[EPD_ROW_BYTES];
+  uint8_t sent = 0;
+
+  ePaperAsync<BUS>::waitReady();
+  //turn on partial update mode
+  BUS::writeCMD(0x91);
+  for (uint8_t i = 0; i < dirty.count; i++)
+  {
+    EPD_TIMED(TIMING_WINDOW, i);
+    EPD_Window band = dirty.window[i];
+    uint8_t n = band.xb2 - band.xb1 + 1;
+    uint8_t band_rows = sizeof(epd_band_bw) / n;
+    for (uint16_t y = dirty.window[i].y1; y <= dirty.window[i].y2; y += band_rows)
+    {
+      uint16_t left = dirty.window[i].y2 - y + 1;
+      uint8_t rows = (left < band_rows) ? left : band_rows;
+      for (uint8_t r = 0; r < rows; r++)
+      {
+        canvas.rasterRow(y + r, bw, yellow);
+        memcpy(&epd_band_bw[r * n], bw + band.xb1, n);
+        memcpy(&epd_band_yellow[r * n], yellow + band.xb1, n);
+      }
+      band.y1 = y;
+      band.y2 = y + rows - 1;
+      setPartialWindow<BUS>(band);
+      BUS::writeCMDData(0x10, epd_band_bw, (uint16_t)rows * n);
+      BUS::writeCMDData(0x13, epd_band_yellow, (uint16_t)rows * n);
+      sent++;
+    }
+  }
+  //refresh the area covering all of the windows at once
+  if (1 < sent)
+  {
+    setPartialWindow<BUS>(dirty.bounds());
+  }
+  ePaperAsync<BUS>::partialRefresh();
+  dirty.clear();
+}
+
+//=============================================================================
+#endif
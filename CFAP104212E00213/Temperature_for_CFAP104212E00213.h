@@ -0,0 +1,169 @@
+#ifndef __TEMPERATURE_FOR_CFAP104212E00213_H__
+#define __TEMPERATURE_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Temperature compensated waveforms
+//
+// Waveforms are timed in frames, so the PLL (0x30) frame rate sets how long
+// a refresh takes. The controller's own sensor is read with TSC (0x40), and
+// the band of TEMP_BAND[] for the profile the sketch selected (see
+// ePaperLUT) and that temperature gives both the profile to load and the
+// PLL value.
+//
+// The OTP waveforms are compensated inside the controller as well; the
+// register waveforms are not, so below 5 C the register B/W profiles give
+// way to the OTP B/W one. Cold panels get 50 Hz, twice the time per frame.
+//
+// The B/W profiles run at 150 Hz from 18 C: they have no yellow phases,
+// and black and white particles move fast enough in a warm panel to settle
+// in the shorter frames. The tri-color waveform stays at the 100 Hz it is
+// specified at. Its faster warm bands (150 Hz from 18 C, 200 Hz from 30 C)
+// are not covered by the datasheet and are only built in with EPD_TEMP_FAST
+// set to 1, for panels where the yellow has been checked to still come up
+// fully at those rates.
+//
+// A reading is cached for EPD_TEMP_MAX_AGE milliseconds, and PLL is only
+// rewritten when the band changes.
+//=============================================================================
+
+//How long a temperature reading is trusted
+#ifndef EPD_TEMP_MAX_AGE
+#define EPD_TEMP_MAX_AGE (10UL * 60UL * 1000UL)
+#endif
+
+//Drive warm panels faster than the tri-color waveform is specified for
+#ifndef EPD_TEMP_FAST
+#define EPD_TEMP_FAST (0)
+#endif
+
+struct Temp_Band
+{
+  //profile selected with ePaperLUT::select()
+  uint8_t selected;
+  //band applies below this temperature, degrees C
+  int8_t  below;
+  //profile loaded instead
+  uint8_t profile;
+  //PLL Control (0x30): 3C = 50Hz, 3A = 100Hz, 29 = 150Hz, 39 = 200Hz
+  uint8_t pll;
+};
+
+//Checked in order, the last band of a selected profile catches everything
+const Temp_Band TEMP_BAND[] PROGMEM =
+{
+  { LUT_TRICOLOR,   5, LUT_TRICOLOR, 0x3c },
+#if EPD_TEMP_FAST
+  { LUT_TRICOLOR,  18, LUT_TRICOLOR, 0x3a },
+  { LUT_TRICOLOR,  30, LUT_TRICOLOR, 0x29 },
+  { LUT_TRICOLOR, 127, LUT_TRICOLOR, 0x39 },
+#else
+  { LUT_TRICOLOR, 127, LUT_TRICOLOR, 0x3a },
+#endif
+  { LUT_OTP_BW,     5, LUT_OTP_BW,   0x3c },
+  { LUT_OTP_BW,    18, LUT_OTP_BW,   0x3a },
+  { LUT_OTP_BW,   127, LUT_OTP_BW,   0x29 },
+  { LUT_FAST_BW,    5, LUT_OTP_BW,   0x3c },
+  { LUT_FAST_BW,   18, LUT_FAST_BW,  0x3a },
+  { LUT_FAST_BW,  127, LUT_FAST_BW,  0x29 },
+  { LUT_PARTIAL,    5, LUT_OTP_BW,   0x3c },
+  { LUT_PARTIAL,   18, LUT_PARTIAL,  0x3a },
+  { LUT_PARTIAL,  127, LUT_PARTIAL,  0x29 },
+};
+#define TEMP_BANDS (sizeof(TEMP_BAND) / sizeof(TEMP_BAND[0]))
+
+template<class BUS>
+struct ePaperTemperature
+{
+  typedef ePaperLUT<BUS> LUT;
+
+  //Measure now. TSC returns the whole degrees C as a signed first byte;
+  //the second byte holds the fraction and is ignored.
+  static int8_t read(void)
+  {
+    uint8_t tsc[2];
+    ePaperAsync<BUS>::waitReady();
+    {
+      EPD_TIMED(TIMING_BUSY, 0x40);
+      BUS::writeCMD(0x40);
+      BUS::waitReady();
+    }
+    BUS::readData(tsc, 2);
+    celsius = (int8_t)tsc[0];
+    read_at = millis();
+    valid = true;
+    return celsius;
+  }
+
+  //Cached reading, measured again once it is too old
+  static int8_t temperature(void)
+  {
+    if (!valid || (EPD_TEMP_MAX_AGE < (uint32_t)(millis() - read_at)))
+    {
+      read();
+    }
+    return celsius;
+  }
+
+  //Forget the band, after a reset or deep sleep
+  static void invalidate(void)
+  {
+    band = 0xff;
+  }
+
+  //Measure again next time, after millis() has stood still (MCU sleep)
+  static void expire(void)
+  {
+    valid = false;
+  }
+
+  //Load the profile and program the PLL of the band for the selected
+  //profile (LUT_TRICOLOR if none) at the current temperature
+  static void apply(void)
+  {
+    int8_t t = temperature();
+    uint8_t selected = (LUT::selected() == 0xff) ? LUT_TRICOLOR : LUT::selected();
+    uint8_t b = 0xff;
+    for (uint8_t i = 0; i < TEMP_BANDS; i++)
+    {
+      if (pgm_read_byte(&TEMP_BAND[i].selected) != selected)
+      {
+        continue;
+      }
+      b = i;
+      if (t < (int8_t)pgm_read_byte(&TEMP_BAND[i].below))
+      {
+        break;
+      }
+    }
+    if (b == 0xff)
+    {
+      return;
+    }
+    LUT::load(pgm_read_byte(&TEMP_BAND[b].profile));
+    if (b != band)
+    {
+      //PLL Control
+      BUS::writeCMDFill(0x30, pgm_read_byte(&TEMP_BAND[b].pll), 1);
+      band = b;
+    }
+  }
+
+private:
+  static int8_t   celsius;
+  static uint32_t read_at;
+  static bool     valid;
+  static uint8_t  band;
+};
+
+template<class BUS> int8_t ePaperTemperature<BUS>::celsius = 0;
+template<class BUS> uint32_t ePaperTemperature<BUS>::read_at = 0;
+template<class BUS> bool ePaperTemperature<BUS>::valid = false;
+template<class BUS> uint8_t ePaperTemperature<BUS>::band = 0xff;
+
+//=============================================================================
+#endif
@@ -0,0 +1,306 @@
+#ifndef __TEXT_FOR_CFAP104212E00213_H__
+#define __TEXT_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Text
+//
+// Fonts are PROGMEM bitmaps (see Fonts_for_CFAP104212E00213.h, written by
+// tools/make_fonts.py) with a glyph index table: each character has its own
+// width and advance, and its rows are stored the way the panel stores
+// pixels, MSB on the left. A glyph row is placed into a plane row with a
+// shift and an OR, so a line of text is made one panel row at a time as it
+// is streamed and never needs a frame buffer.
+//
+// textRow() makes one row of a string. ePaperTextField is a box on the
+// panel (a counter, a reading) that updateTextField() redraws as a partial
+// update of just that box; ePaperCanvas can also hold text items.
+//
+// Glyph rows go through a small cache keyed by character and row. While a
+// row of "1000" is made the three zeros are looked up once, which saves the
+// index and bitmap reads from flash for every repeat.
+//=============================================================================
+
+//Widest glyph handled, in pixels
+#define EPD_GLYPH_MAX_WIDTH (16)
+
+//Glyph rows cached, a power of 2, 8 bytes of SRAM each; 0 turns the cache
+//off. 16 keeps the digits apart.
+#ifndef EPD_GLYPH_CACHE
+#define EPD_GLYPH_CACHE (16)
+#endif
+
+//In PROGMEM, one per character from first to last
+struct EPD_Glyph
+{
+  //of the glyph's first row in bitmap
+  uint16_t offset;
+  //inked columns, 0-EPD_GLYPH_MAX_WIDTH
+  uint8_t  width;
+  //pixels to the next glyph's left edge
+  uint8_t  advance;
+};
+
+//In RAM, the tables it points at are in PROGMEM
+struct EPD_Font
+{
+  const uint8_t   *bitmap;
+  const EPD_Glyph *glyph;
+  uint8_t first;
+  uint8_t last;
+  //rows in every glyph
+  uint8_t height;
+};
+
+//One row of one glyph, bits MSB aligned: bit 15 is the leftmost pixel
+struct EPD_GlyphRow
+{
+  uint16_t bits;
+  uint8_t  width;
+  uint8_t  advance;
+};
+
+#if EPD_GLYPH_CACHE
+struct EPD_GlyphCacheEntry
+{
+  const EPD_Font *font;
+  char            c;
+  uint8_t         row;
+  EPD_GlyphRow    glyph;
+};
+EPD_GlyphCacheEntry epd_glyph_cache[EPD_GLYPH_CACHE];
+#endif
+
+//Row r of c's glyph (characters outside the font are blank), r < height
+static void glyphRow(const EPD_Font &font, char c, uint8_t r, EPD_GlyphRow &g)
+{
+#if EPD_GLYPH_CACHE
+  EPD_GlyphCacheEntry &entry = epd_glyph_cache[(uint8_t)c & (EPD_GLYPH_CACHE - 1)];
+  if ((entry.font == &font) && (entry.c == c) && (entry.row == r))
+  {
+    g = entry.glyph;
+    return;
+  }
+#endif
+  uint8_t i = (uint8_t)c;
+  if ((i < font.first) || (font.last < i))
+  {
+    i = font.first;
+  }
+  const EPD_Glyph *glyph = &font.glyph[i - font.first];
+  g.width = pgm_read_byte(&glyph->width);
+  g.advance = pgm_read_byte(&glyph->advance);
+  g.bits = 0;
+  if ((uint8_t)c == i)
+  {
+    const uint8_t *src = font.bitmap + pgm_read_word(&glyph->offset);
+    if (8 < g.width)
+    {
+      src += (uint16_t)r << 1;
+      g.bits = ((uint16_t)pgm_read_byte(src) << 8) | pgm_read_byte(src + 1);
+    }
+    else if (g.width != 0)
+    {
+      g.bits = (uint16_t)pgm_read_byte(src + r) << 8;
+    }
+  }
+#if EPD_GLYPH_CACHE
+  entry.font = &font;
+  entry.c = c;
+  entry.row = r;
+  entry.glyph = g;
+#endif
+}
+
+//Width of s in pixels, the last glyph's advance included
+uint16_t textWidth(const EPD_Font &font, const char *s)
+{
+  uint16_t width = 0;
+  EPD_GlyphRow g;
+  for (; *s; s++)
+  {
+    glyphRow(font, *s, 0, g);
+    width += g.advance;
+  }
+  return width;
+}
+
+//OR 16 MSB aligned bits into row at pixel x, clipped to the panel
+static void orBits(uint8_t *row, int16_t x, uint16_t bits)
+{
+  if (x < 0)
+  {
+    if (x <= -16)
+    {
+      return;
+    }
+    bits <<= -x;
+    x = 0;
+  }
+  uint8_t b = x >> 3;
+  uint32_t spread = (uint32_t)bits << (8 - (x & 7));
+  for (uint8_t i = 0; (i < 3) && (b < EPD_ROW_BYTES); i++, b++)
+  {
+    row[b] |= spread >> (16 - (i << 3));
+  }
+}
+
+//OR row r (0 = top) of s, its left edge at pixel x, into a plane row of
+//EPD_ROW_BYTES
+void textRow(const EPD_Font &font, const char *s, int16_t x, uint8_t r, uint8_t *row)
+{
+  EPD_GlyphRow g;
+  for (; *s && (x < EPD_HRES); s++)
+  {
+    glyphRow(font, *s, r, g);
+    if (g.bits)
+    {
+      orBits(row, x, g.bits);
+    }
+    x += g.advance;
+  }
+}
+
+//Pixel u, r of s (relative to its top left), for drawing text turned
+static bool textPixel(const EPD_Font &font, const char *s, int16_t u, uint8_t r)
+{
+  EPD_GlyphRow g;
+  for (; *s && (0 <= u); s++)
+  {
+    glyphRow(font, *s, r, g);
+    if (u < g.advance)
+    {
+      return (u < 16) && (g.bits & (0x8000 >> u));
+    }
+    u -= g.advance;
+  }
+  return false;
+}
+
+//=============================================================================
+// Text fields
+//
+// A field is a box of its font's height that always shows one string, for
+// example a counter. updateTextField() clears the box to white, draws the
+// string aligned in it and starts a partial refresh of just the box.
+// The box is widened to whole bytes (the window's granularity) and that
+// margin is cleared too. Only the part of the box on the panel is sent.
+#define TEXT_LEFT   (0)
+#define TEXT_CENTER (1)
+#define TEXT_RIGHT  (2)
+
+struct ePaperTextField
+{
+  const EPD_Font *font;
+  int16_t  x;
+  int16_t  y;
+  uint16_t width;
+  //EPD_BLACK or EPD_YELLOW on white
+  uint8_t  color;
+  uint8_t  align;
+  const char *text;
+
+  //Left edge of the text for the current string
+  int16_t textX(void) const
+  {
+    uint16_t w = textWidth(*font, text);
+    if ((align == TEXT_LEFT) || (width <= w))
+    {
+      return x;
+    }
+    return x + ((align == TEXT_RIGHT) ? (width - w) : ((width - w) >> 1));
+  }
+
+  //Window covering the box, clipped to the panel. False if none of the
+  //box is on the panel.
+  bool window(EPD_Window &w) const
+  {
+    int16_t x1 = x;
+    int16_t y1 = y;
+    int16_t x2 = x + (int16_t)width - 1;
+    int16_t y2 = y + font->height - 1;
+    if ((width == 0) || (x2 < 0) || (y2 < 0) || (EPD_HRES <= x1) || (EPD_VRES <= y1))
+    {
+      return false;
+    }
+    if (x1 < 0) { x1 = 0; }
+    if (y1 < 0) { y1 = 0; }
+    if (EPD_HRES <= x2) { x2 = EPD_HRES - 1; }
+    if (EPD_VRES <= y2) { y2 = EPD_VRES - 1; }
+    w.xb1 = x1 >> 3;
+    w.xb2 = x2 >> 3;
+    w.y1 = y1;
+    w.y2 = y2;
+    return true;
+  }
+
+  //Row source for partialUpdateWindows(), context is the field
+  static void rowSource(uint8_t plane, uint16_t y, uint8_t first_byte,
+                        uint8_t n, uint8_t *bytes, void *context)
+  {
+    const ePaperTextField &f = *(const ePaperTextField *)context;
+    uint8_t row[EPD_ROW_BYTES];
+    memset(row, 0x00, EPD_ROW_BYTES);
+    //0x10 is 1 for black, 0x13 is 1 for yellow
+    if ((plane == 0) == (f.color == EPD_BLACK))
+    {
+      textRow(*f.font, f.text, f.textX(), y - f.y, row);
+    }
+    memcpy(bytes, row + first_byte, n);
+  }
+};
+
+//Show text in field with a partial update of just the field, returning once
+//the refresh has started. Returns the microseconds from the call to the
+//refresh command (0x12), the latency the user sees beyond the panel's own
+//refresh time, or 0 if the field is off the panel and nothing was sent.
+template<class BUS>
+uint32_t updateTextField(ePaperTextField &field, const char *text)
+{
+  uint32_t start = micros();
+  field.text = text;
+  EPD_Window w;
+  if (!field.window(w))
+  {
+    return 0;
+  }
+  //the text's left edge is worked out once, not per row
+  int16_t text_x = field.textX();
+  uint8_t n = w.xb2 - w.xb1 + 1;
+  uint8_t row[EPD_ROW_BYTES];
+
+  ePaperAsync<BUS>::waitReady();
+  //turn on partial update mode
+  BUS::writeCMD(0x91);
+  setPartialWindow<BUS>(w);
+  for (uint8_t plane = 0; plane < 2; plane++)
+  {
+    bool inked = (plane == 0) == (field.color == EPD_BLACK);
+    if (!inked)
+    {
+      //the other plane of the box is only cleared
+      BUS::writeCMDFill(plane ? 0x13 : 0x10, 0x00, windowBytes(w));
+      continue;
+    }
+    BUS::beginCMD(plane ? 0x13 : 0x10);
+    for (uint16_t y = w.y1; y <= w.y2; y++)
+    {
+      memset(row, 0x00, EPD_ROW_BYTES);
+      textRow(*field.font, text, text_x, y - field.y, row);
+      BUS::streamBuffer(row + w.xb1, n);
+    }
+    BUS::endTransfer();
+  }
+  //0x92 follows from ePaperAsync when the refresh is done
+  ePaperAsync<BUS>::partialRefresh();
+  uint32_t latency = micros() - start;
+  timingRecord(TIMING_TEXT, (uint8_t)strlen(text), start, start + latency);
+  return latency;
+}
+
+//=============================================================================
+#endif
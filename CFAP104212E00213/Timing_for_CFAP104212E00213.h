@@ -0,0 +1,140 @@
+#ifndef __TIMING_FOR_CFAP104212E00213_H__
+#define __TIMING_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Phase timing
+//
+// With EPD_TIMING set to 1 each panel operation (reset, power on, LUT
+// upload, plane data, partial windows, BUSY periods, SD reads) is stamped
+// with micros() into a ring of EPD_TIMING_DEPTH records. Nothing is printed
+// while it runs; timingDumpCSV() or timingDumpBinary() sends the records
+// afterwards, oldest first. With EPD_TIMING 0 every hook compiles to nothing
+// and the dump functions are empty.
+//
+// A phase is timed by opening a scope with EPD_TIMED(phase, detail), or
+// with timingRecord() when it starts and ends in different places.
+//=============================================================================
+
+#ifndef EPD_TIMING
+#define EPD_TIMING (0)
+#endif
+
+//Records kept, 10 bytes of SRAM each. The oldest are overwritten.
+#ifndef EPD_TIMING_DEPTH
+#define EPD_TIMING_DEPTH (32)
+#endif
+
+//Phases, detail is noted where it is used
+#define TIMING_RESET    (0) //reset pulse and recovery
+#define TIMING_POWER_ON (1) //BUSY after Power On (0x04)
+#define TIMING_LUT      (2) //register LUT upload, detail = profile
+#define TIMING_PLANE    (3) //plane data, detail = 0x10 or 0x13
+#define TIMING_WINDOW   (4) //a partial window or band, both planes, detail =
+                            //window index or first row of the band
+#define TIMING_REFRESH  (5) //BUSY after 0x12, detail 0 = full, 1 = partial
+#define TIMING_SD       (6) //read and decode of a band from SD, detail = rows
+#define TIMING_BUSY     (7) //any other BUSY period, detail = command
+#define TIMING_TEXT     (8) //text field update from the call to its 0x12,
+                            //detail = characters
+#define TIMING_UPLOAD   (9) //serial upload from its first frame to its 0x12,
+                            //detail = flags
+
+struct EPD_Timing
+{
+  uint8_t  phase;
+  uint8_t  detail;
+  //micros() at the start and the length of the phase
+  uint32_t start;
+  uint32_t us;
+};
+
+#if EPD_TIMING
+EPD_Timing epd_timing[EPD_TIMING_DEPTH];
+uint8_t epd_timing_next = 0;
+uint8_t epd_timing_count = 0;
+
+//Record a phase that ran from start to end, both micros() values
+static void timingRecord(uint8_t phase, uint8_t detail, uint32_t start, uint32_t end)
+{
+  EPD_Timing &t = epd_timing[epd_timing_next];
+  t.phase = phase;
+  t.detail = detail;
+  t.start = start;
+  t.us = end - start;
+  epd_timing_next = (epd_timing_next + 1) % EPD_TIMING_DEPTH;
+  if (epd_timing_count < EPD_TIMING_DEPTH)
+  {
+    epd_timing_count++;
+  }
+}
+
+//Records its phase when it goes out of scope
+struct ePaperTimed
+{
+  uint32_t start;
+  uint8_t  phase;
+  uint8_t  detail;
+  ePaperTimed(uint8_t p, uint8_t d) : start(micros()), phase(p), detail(d) {}
+  ~ePaperTimed() { timingRecord(phase, detail, start, micros()); }
+};
+#define EPD_TIMED(phase, detail) ePaperTimed epd_timed_(phase, detail)
+
+static inline const EPD_Timing &timingAt(uint8_t i)
+{
+  //i = 0 is the oldest record kept
+  return epd_timing[(epd_timing_next + EPD_TIMING_DEPTH - epd_timing_count + i) % EPD_TIMING_DEPTH];
+}
+
+//One line per record: phase,detail,start_us,us
+void timingDumpCSV(Print &out)
+{
+  out.println(F("phase,detail,start_us,us"));
+  for (uint8_t i = 0; i < epd_timing_count; i++)
+  {
+    const EPD_Timing &t = timingAt(i);
+    out.print(t.phase);
+    out.print(',');
+    out.print(t.detail);
+    out.print(',');
+    out.print(t.start);
+    out.print(',');
+    out.println(t.us);
+  }
+  epd_timing_count = 0;
+}
+
+//'T', the record count, then each record as phase, detail and two little
+//endian uint32_t: 10 bytes per record
+void timingDumpBinary(Print &out)
+{
+  out.write('T');
+  out.write(epd_timing_count);
+  for (uint8_t i = 0; i < epd_timing_count; i++)
+  {
+    const EPD_Timing &t = timingAt(i);
+    uint8_t record[10] =
+    {
+      t.phase, t.detail,
+      (uint8_t)t.start, (uint8_t)(t.start >> 8),
+      (uint8_t)(t.start >> 16), (uint8_t)(t.start >> 24),
+      (uint8_t)t.us, (uint8_t)(t.us >> 8),
+      (uint8_t)(t.us >> 16), (uint8_t)(t.us >> 24)
+    };
+    out.write(record, sizeof(record));
+  }
+  epd_timing_count = 0;
+}
+#else
+#define EPD_TIMED(phase, detail)
+static inline void timingRecord(uint8_t, uint8_t, uint32_t, uint32_t) {}
+static inline void timingDumpCSV(Print &) {}
+static inline void timingDumpBinary(Print &) {}
+#endif
+
+//=============================================================================
+#endif
@@ -0,0 +1,419 @@
+#ifndef __UPLOAD_FOR_CFAP104212E00213_H__
+#define __UPLOAD_FOR_CFAP104212E00213_H__
+//=============================================================================
+// "Arduino" example program for Crystalfontz ePaper.
+//
+// This project is for the CFAP104212E0-0213:
+//
+//   https://www.crystalfontz.com/product/cfap104212E00213
+//=============================================================================
+// Serial image upload
+//
+// Images come in over the serial port as frames (tools/epd_upload.py is the
+// sender). Each frame is checked and its data goes straight on to 0x10 and
+// 0x13, so only one frame is ever held in RAM, never a plane.
+//
+// Frame, both ways:
+//
+//   0xE5 0x9D type seq length(2) payload(length) crc(2)
+//
+// Numbers are little endian. The CRC is crc16() (CRC-16/CCITT, from 0xFFFF)
+// over type, seq, length and payload. Types from the sender:
+//
+//   'B' begin   flags, xb1, xb2, y1(2), y2(2)
+//               UPLOAD_PARTIAL: only the window (byte columns xb1-xb2, rows
+//               y1-y2, inclusive) is sent and refreshed, otherwise the whole
+//               panel and the window is ignored. UPLOAD_PACKED: the data is
+//               in the run format of Packed_for_CFAP104212E00213.h.
+//   'D' data    the next part of the BW plane then the yellow plane, each
+//               the window's rows of (xb2 - xb1 + 1) bytes. Packed runs may
+//               be split across frames and across the two planes.
+//   'E' end     no payload; all of the data must have arrived. The panel is
+//               refreshed and 'E' is answered once the refresh has started.
+//
+// Every frame is answered with 'A' and one status byte, UPLOAD_OK or why it
+// was refused, carrying the frame's seq. That is the flow control: the
+// sender waits for each answer before sending the next frame, so the 64
+// byte receive buffer of an Uno cannot overrun while a frame goes to the
+// panel. A frame with a bad CRC is answered UPLOAD_CRC and sent again; one
+// that repeats the last seq (its answer was lost) is answered again without
+// being used twice. 'B' is refused with UPLOAD_BUSY until the panel has
+// finished the last refresh, the sender just asks again.
+//
+// Anything between frames, like the sketch's debug prints, is skipped by
+// both ends while they look for 0xE5 0x9D.
+//=============================================================================
+
+//1 Mbaud divides the 16 MHz clock of an Uno exactly, 115200 is 2% off
+#ifndef EPD_UPLOAD_BAUD
+#define EPD_UPLOAD_BAUD (1000000UL)
+#endif
+
+//Largest payload, sets the frame buffer size
+#ifndef EPD_UPLOAD_PAYLOAD
+#define EPD_UPLOAD_PAYLOAD (128)
+#endif
+
+//A frame that stops arriving for this long is dropped
+#define EPD_UPLOAD_TIMEOUT_MS (100)
+
+#define UPLOAD_SYNC1 (0xE5)
+#define UPLOAD_SYNC2 (0x9D)
+
+//'B' flags
+#define UPLOAD_PARTIAL (0x01)
+#define UPLOAD_PACKED  (0x02)
+
+//'A' status
+#define UPLOAD_OK       (0)
+#define UPLOAD_CRC      (1) //CRC did not match, send it again
+#define UPLOAD_FRAME    (2) //unknown type or wrong length
+#define UPLOAD_SEQUENCE (3) //'D' or 'E' without a 'B', or a skipped seq
+#define UPLOAD_OVERFLOW (4) //more data than the window holds
+#define UPLOAD_SHORT    (5) //'E' before all of the data
+#define UPLOAD_WINDOW   (6) //window off the panel
+#define UPLOAD_BUSY     (7) //panel still refreshing, ask again
+
+template<class PANEL>
+struct ePaperUpload
+{
+  typedef typename PANEL::Bus BUS;
+
+  ePaperUpload() : state(WAIT_SYNC1), active(false), have_last(false) {}
+
+  //Read whatever port has received and act on any whole frames, call as
+  //often as possible. PORT is Serial or any other Arduino Stream.
+  template<class PORT>
+  void service(PORT &port)
+  {
+    if ((state != WAIT_SYNC1) && (EPD_UPLOAD_TIMEOUT_MS < (uint32_t)(millis() - frame_start)))
+    {
+      state = WAIT_SYNC1;
+    }
+    while (0 < port.available())
+    {
+      if (receive((uint8_t)port.read()))
+      {
+        reply(port, handle());
+      }
+    }
+  }
+
+private:
+  enum
+  {
+    WAIT_SYNC1,
+    WAIT_SYNC2,
+    HEADER,
+    PAYLOAD,
+    CRC
+  };
+
+  //Take one byte, true once a frame with a good CRC or a bad one is in
+  bool receive(uint8_t c)
+  {
+    switch (state)
+    {
+      case WAIT_SYNC1:
+        if (c == UPLOAD_SYNC1)
+        {
+          state = WAIT_SYNC2;
+          frame_start = millis();
+        }
+        return false;
+      case WAIT_SYNC2:
+        state = (c == UPLOAD_SYNC2) ? HEADER : (c == UPLOAD_SYNC1) ? WAIT_SYNC2 : WAIT_SYNC1;
+        got = 0;
+        return false;
+      case HEADER:
+        header[got++] = c;
+        if (got == sizeof(header))
+        {
+          length = header[2] | ((uint16_t)header[3] << 8);
+          if (EPD_UPLOAD_PAYLOAD < length)
+          {
+            //not a frame after all, look for the next
+            state = WAIT_SYNC1;
+            return false;
+          }
+          got = 0;
+          state = (length != 0) ? PAYLOAD : CRC;
+        }
+        return false;
+      case PAYLOAD:
+        payload[got++] = c;
+        if (got == length)
+        {
+          got = 0;
+          state = CRC;
+        }
+        return false;
+      default:
+        crc[got++] = c;
+        if (got < 2)
+        {
+          return false;
+        }
+        state = WAIT_SYNC1;
+        return true;
+    }
+  }
+
+  //Act on the frame just received, returns its status
+  uint8_t handle(void)
+  {
+    uint16_t check = crc16(crc16(0xffff, header, sizeof(header)), payload, length);
+    if (check != (crc[0] | ((uint16_t)crc[1] << 8)))
+    {
+      return UPLOAD_CRC;
+    }
+    uint8_t type = header[0];
+    uint8_t seq = header[1];
+    if (have_last && (seq == last_seq) && (type == last_type))
+    {
+      //a repeat, its answer went missing
+      return UPLOAD_OK;
+    }
+    uint8_t status;
+    if (type == 'B')
+    {
+      status = begin();
+    }
+    else if (!active || (seq != (uint8_t)(last_seq + 1)))
+    {
+      status = UPLOAD_SEQUENCE;
+    }
+    else if (type == 'D')
+    {
+      status = data();
+    }
+    else if (type == 'E')
+    {
+      status = end();
+    }
+    else
+    {
+      status = UPLOAD_FRAME;
+    }
+    if (status == UPLOAD_OK)
+    {
+      //only frames that were used move seq on
+      have_last = true;
+      last_seq = seq;
+      last_type = type;
+    }
+    else if (active && (status != UPLOAD_SEQUENCE))
+    {
+      //the sender gives up on this upload and starts over with 'B'
+      abort();
+    }
+    return status;
+  }
+
+  uint8_t begin(void)
+  {
+    if (length != 7)
+    {
+      return UPLOAD_FRAME;
+    }
+    if (active)
+    {
+      abort();
+    }
+    if (!PANEL::Async::idle())
+    {
+      return UPLOAD_BUSY;
+    }
+    flags = payload[0];
+    if (flags & UPLOAD_PARTIAL)
+    {
+      window.xb1 = payload[1];
+      window.xb2 = payload[2];
+      window.y1 = payload[3] | ((uint16_t)payload[4] << 8);
+      window.y2 = payload[5] | ((uint16_t)payload[6] << 8);
+      if ((window.xb2 < window.xb1) || (EPD_ROW_BYTES <= window.xb2) ||
+          (window.y2 < window.y1) || (EPD_VRES <= window.y2))
+      {
+        return UPLOAD_WINDOW;
+      }
+    }
+    else
+    {
+      window.xb1 = 0;
+      window.xb2 = EPD_ROW_BYTES - 1;
+      window.y1 = 0;
+      window.y2 = EPD_VRES - 1;
+    }
+    upload_start = micros();
+    active = true;
+    plane = 0;
+    plane_left = windowBytes(window);
+    run_left = 0;
+    need_value = false;
+
+    PANEL::Async::waitReady();
+    if (flags & UPLOAD_PARTIAL)
+    {
+      //turn on partial update mode
+      BUS::writeCMD(0x91);
+      setPartialWindow<BUS>(window);
+    }
+    //the panel is deselected between frames while the port is read
+    BUS::beginCMD(0x10);
+    BUS::endTransfer();
+    return UPLOAD_OK;
+  }
+
+  //Drop the upload in progress, what reached the panel's RAM stays there
+  void abort(void)
+  {
+    if (flags & UPLOAD_PARTIAL)
+    {
+      //turn off partial update mode
+      BUS::writeCMD(0x92);
+    }
+    active = false;
+  }
+
+  uint8_t data(void)
+  {
+    if (!(flags & UPLOAD_PACKED))
+    {
+      return send(payload, 0, length);
+    }
+    //runs carry on from the last frame
+    uint16_t i = 0;
+    while (i < length)
+    {
+      if (run_left == 0)
+      {
+        uint8_t c = payload[i++];
+        run_fill = (0 != (c & 0x80));
+        run_left = run_fill ? ((c & 0x7f) + 2) : (c + 1);
+        need_value = run_fill;
+        continue;
+      }
+      uint8_t status;
+      if (run_fill)
+      {
+        if (need_value)
+        {
+          run_value = payload[i++];
+          need_value = false;
+        }
+        status = send(0, run_value, run_left);
+        run_left = 0;
+      }
+      else
+      {
+        uint8_t c = ((length - i) < run_left) ? (length - i) : run_left;
+        status = send(payload + i, 0, c);
+        i += c;
+        run_left -= c;
+      }
+      if (status != UPLOAD_OK)
+      {
+        return status;
+      }
+    }
+    return UPLOAD_OK;
+  }
+
+  //Send n bytes from bytes, or n copies of value if bytes is 0, moving on
+  //to the yellow plane when the BW plane is full
+  uint8_t send(const uint8_t *bytes, uint8_t value, uint16_t n)
+  {
+    while (n != 0)
+    {
+      if (plane_left == 0)
+      {
+        if (plane != 0)
+        {
+          return UPLOAD_OVERFLOW;
+        }
+        plane = 1;
+        plane_left = windowBytes(window);
+        BUS::beginCMD(0x13);
+        BUS::endTransfer();
+      }
+      uint16_t c = (n < plane_left) ? n : plane_left;
+      BUS::beginData();
+      if (bytes)
+      {
+        BUS::streamData(bytes, c);
+        bytes += c;
+      }
+      else
+      {
+        BUS::streamFill(value, c);
+      }
+      BUS::endTransfer();
+      plane_left -= c;
+      n -= c;
+    }
+    return UPLOAD_OK;
+  }
+
+  uint8_t end(void)
+  {
+    if ((length != 0) || (plane == 0) || (plane_left != 0) ||
+        (run_left != 0) || need_value)
+    {
+      return (length != 0) ? UPLOAD_FRAME : UPLOAD_SHORT;
+    }
+    active = false;
+    if (flags & UPLOAD_PARTIAL)
+    {
+      //0x92 follows from the queue when the refresh is done
+      PANEL::Async::partialRefresh();
+    }
+    else
+    {
+      //Data Stop
+      BUS::writeCMD(0x11);
+      PANEL::refresh();
+    }
+    timingRecord(TIMING_UPLOAD, flags, upload_start, micros());
+    return UPLOAD_OK;
+  }
+
+  template<class PORT>
+  void reply(PORT &port, uint8_t status)
+  {
+    uint8_t frame[9] = { UPLOAD_SYNC1, UPLOAD_SYNC2, 'A', header[1], 1, 0, status };
+    uint16_t check = crc16(0xffff, frame + 2, 5);
+    frame[7] = (uint8_t)check;
+    frame[8] = (uint8_t)(check >> 8);
+    port.write(frame, sizeof(frame));
+  }
+
+  //receiver
+  uint8_t  state;
+  uint8_t  header[4];
+  uint16_t length;
+  uint8_t  payload[EPD_UPLOAD_PAYLOAD];
+  uint8_t  crc[2];
+  uint16_t got;
+  uint32_t frame_start;
+
+  //the upload in progress
+  bool       active;
+  uint8_t    flags;
+  EPD_Window window;
+  uint8_t    plane;
+  uint16_t   plane_left;
+  uint32_t   upload_start;
+  //packed run being decoded
+  uint8_t    run_left;
+  bool       run_fill;
+  bool       need_value;
+  uint8_t    run_value;
+
+  //last frame used, for repeats
+  bool    have_last;
+  uint8_t last_seq;
+  uint8_t last_type;
+};
+
+//=============================================================================
+#endif
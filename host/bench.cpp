@@ -0,0 +1,207 @@
+//=============================================================================
+// Host benchmark: the sketch's setup() and two passes of loop() against the
+// controller emulator.
+//
+// Every reportStats() call in the sketch ends a scenario (splash, white,
+// black, yellow, checkerboard, partial, ..., one per BMP). For each the
+// table gives the bytes and CS falling edges the panels saw and the modeled
+// time: clocking bytes in, BUSY low, and the whole scenario without the
+// sketch's delay() calls for viewing. The glass after each scenario is
+// written to OUT/<pass>-<label>.ppm.
+//
+//   bench [OUT]    default build/out
+//
+// The SD card holds a gradient BMP at 1, 8 and 24 bits per pixel, each
+// stored bottom-up and top-down; the second pass shows them from their .EPD
+// caches.
+//=============================================================================
+#include <Arduino.h>
+#include <SD.h>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+#include "emulator.h"
+#include "bmp_writer.h"
+
+void setup(void);
+void loop(void);
+
+struct BenchRow
+{
+  std::string label;
+  EmuStats    stats;
+  uint64_t    active_ns;
+  uint32_t    errors;
+};
+
+static std::vector<BenchRow> rows;
+static std::vector<EmuStats> last_stats;
+static uint64_t last_now = 0;
+static uint64_t last_delay = 0;
+static uint32_t last_errors = 0;
+static const char *out_dir = "build/out";
+static int pass = 0;
+
+static void subtract(EmuStats &a, const EmuStats &b)
+{
+  a.bytes -= b.bytes;
+  a.commands -= b.commands;
+  a.cs_edges -= b.cs_edges;
+  a.refreshes -= b.refreshes;
+  a.partial_refreshes -= b.partial_refreshes;
+  a.transfer_ns -= b.transfer_ns;
+  a.busy_ns -= b.busy_ns;
+}
+
+static void add(EmuStats &a, const EmuStats &b)
+{
+  a.bytes += b.bytes;
+  a.commands += b.commands;
+  a.cs_edges += b.cs_edges;
+  a.refreshes += b.refreshes;
+  a.partial_refreshes += b.partial_refreshes;
+  a.transfer_ns += b.transfer_ns;
+  a.busy_ns += b.busy_ns;
+}
+
+//EPD_HOST_REPORT in the sketch's reportStats()
+void hostReport(const char *label)
+{
+  BenchRow row;
+  row.label = label;
+  uint32_t errors = 0;
+  last_stats.resize(emu.controllers.size());
+  for (size_t i = 0; i < emu.controllers.size(); i++)
+  {
+    const EmuController &c = *emu.controllers[i];
+    EmuStats s = c.stats;
+    subtract(s, last_stats[i]);
+    add(row.stats, s);
+    last_stats[i] = c.stats;
+    errors += c.errors;
+
+    if (s.bytes == 0)
+    {
+      continue;
+    }
+    std::string name = std::string(out_dir) + "/" + (char)('0' + pass) + "-";
+    for (const char *p = label; *p; p++)
+    {
+      name += isalnum((unsigned char)*p) ? *p : '_';
+    }
+    if (i != 0)
+    {
+      name += "-cs" + std::to_string(c.cs_pin);
+    }
+    c.writePPM((name + ".ppm").c_str());
+  }
+  row.active_ns = (emu.now_ns - last_now) - (emu.delay_ns - last_delay);
+  row.errors = errors - last_errors;
+  last_now = emu.now_ns;
+  last_delay = emu.delay_ns;
+  last_errors = errors;
+  rows.push_back(row);
+}
+
+//Gradient left to right, a yellow band, a black frame and diagonal
+static uint32_t testColor(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  if ((x < 2) || (y < 2) || (width - 3 < x) || (height - 3 < y) || (x == y))
+  {
+    return 0x000000;
+  }
+  if ((height / 3 <= y) && (y < height / 2))
+  {
+    return 0xffff00;
+  }
+  uint8_t v = 255 * x / (width - 1);
+  return ((uint32_t)v << 16) | ((uint32_t)v << 8) | v;
+}
+
+struct Gradient
+{
+  uint32_t operator()(uint16_t x, uint16_t y) const { return testColor(x, y, 104, 212); }
+};
+
+//The 8 bit palette: 252 greys plus yellow, then the 1 bit one, black/white
+struct Quantized
+{
+  uint8_t levels;
+  uint32_t operator()(uint16_t x, uint16_t y) const
+  {
+    uint32_t rgb = testColor(x, y, 104, 212);
+    if (rgb == 0xffff00)
+    {
+      return (levels == 2) ? 0x000000 : rgb;
+    }
+    uint8_t v = rgb & 0xff;
+    v = (levels == 2) ? ((v < 128) ? 0 : 255) : (v / 4) * 4;
+    return ((uint32_t)v << 16) | ((uint32_t)v << 8) | v;
+  }
+};
+
+static void makeCard(void)
+{
+  static uint32_t grey[256];
+  for (uint16_t i = 0; i < 64; i++)
+  {
+    uint8_t v = i * 4;
+    grey[i] = ((uint32_t)v << 16) | ((uint32_t)v << 8) | v;
+  }
+  grey[64] = 0xffff00;
+  static const uint32_t mono[2] = { 0x000000, 0xffffff };
+  Quantized q8 = { 64 };
+  Quantized q1 = { 2 };
+  for (uint8_t top_down = 0; top_down < 2; top_down++)
+  {
+    std::string t = top_down ? "T" : "";
+    SD.files["GRAD24" + t + ".BMP"] = makeBMP(104, 212, 24, top_down, Gradient());
+    SD.files["PAL8" + t + ".BMP"] = makeBMP(104, 212, 8, top_down, q8, grey, 65);
+    SD.files["MONO1" + t + ".BMP"] = makeBMP(104, 212, 1, top_down, q1, mono, 2);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  if (1 < argc)
+  {
+    out_dir = argv[1];
+  }
+  mkdir(out_dir, 0777);
+
+  //the sketch's panel, and its SECOND_PANEL pins
+  emu.addPanel(10, 5, 4, 3);
+  emu.addPanel(9, 6, 7, 2);
+  makeCard();
+
+  setup();
+  hostReport("setup");
+  for (pass = 1; pass <= 2; pass++)
+  {
+    loop();
+  }
+
+  printf("%-4s %-18s %8s %6s %7s %9s %9s %9s %6s\n", "pass", "scenario", "bytes",
+         "cs", "refresh", "xfer ms", "busy ms", "active ms", "errors");
+  int p = 0;
+  uint32_t errors = 0;
+  for (size_t i = 0; i < rows.size(); i++)
+  {
+    const BenchRow &r = rows[i];
+    if (r.label == "splash")
+    {
+      p++;
+    }
+    printf("%-4d %-18s %8u %6u %3u+%-3u %9.2f %9.1f %9.1f %6u\n", p, r.label.c_str(),
+           r.stats.bytes, r.stats.cs_edges, r.stats.refreshes, r.stats.partial_refreshes,
+           r.stats.transfer_ns / 1e6, r.stats.busy_ns / 1e6, r.active_ns / 1e6, r.errors);
+    errors += r.errors;
+  }
+  for (size_t i = 0; i < emu.controllers.size(); i++)
+  {
+    fputs(emu.controllers[i]->error_log.c_str(), stdout);
+  }
+  printf("modeled %.1f s, %.1f s of it in delay(); bus conflicts %u\n",
+         emu.now_ns / 1e9, emu.delay_ns / 1e9, emu.bus_conflicts);
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+#ifndef __HOST_BMP_WRITER_H__
+#define __HOST_BMP_WRITER_H__
+//=============================================================================
+// Host build: BMP files for the in-memory SD card. width x height, 1, 8 or
+// 24 bits per pixel, rows stored bottom-up (the usual) or top-down (negative
+// height). color(x, y) gives each pixel as 0xRRGGBB; 1 and 8 bit files look
+// it up in palette, which must hold every color used.
+//=============================================================================
+#include <SD.h>
+
+template<class COLOR>
+SD_Data makeBMP(uint16_t width, uint16_t height, uint8_t bpp, bool top_down,
+                COLOR color, const uint32_t *palette = 0, uint16_t colors = 0)
+{
+  uint32_t stride = ((width * bpp + 31) / 32) * 4;
+  uint32_t palette_bytes = (bpp <= 8) ? 4UL * colors : 0;
+  uint32_t offset = 54 + palette_bytes;
+  SD_Data f(offset + stride * height, 0);
+  uint8_t *h = f.data();
+  int32_t stored_height = top_down ? -(int32_t)height : height;
+  const uint32_t fields[] =
+  {
+    //offset, value, bytes
+    2, (uint32_t)f.size(), 4,
+    10, offset, 4,
+    14, 40, 4,
+    18, width, 4,
+    22, (uint32_t)stored_height, 4,
+    26, 1, 2,
+    28, bpp, 2,
+    34, stride * height, 4,
+    46, (bpp <= 8) ? colors : 0U, 4,
+  };
+  h[0] = 'B';
+  h[1] = 'M';
+  for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i += 3)
+  {
+    for (uint32_t b = 0; b < fields[i + 2]; b++)
+    {
+      h[fields[i] + b] = fields[i + 1] >> (8 * b);
+    }
+  }
+  for (uint16_t i = 0; i < colors && bpp <= 8; i++)
+  {
+    h[54 + 4 * i] = palette[i];
+    h[54 + 4 * i + 1] = palette[i] >> 8;
+    h[54 + 4 * i + 2] = palette[i] >> 16;
+  }
+  for (uint16_t y = 0; y < height; y++)
+  {
+    uint8_t *row = h + offset + stride * (top_down ? y : (height - 1 - y));
+    for (uint16_t x = 0; x < width; x++)
+    {
+      uint32_t rgb = color(x, y);
+      if (bpp == 24)
+      {
+        row[3 * x] = rgb;
+        row[3 * x + 1] = rgb >> 8;
+        row[3 * x + 2] = rgb >> 16;
+        continue;
+      }
+      uint16_t index = 0;
+      while ((index < colors - 1) && (palette[index] != rgb))
+      {
+        index++;
+      }
+      if (bpp == 8)
+      {
+        row[x] = index;
+      }
+      else if (index)
+      {
+        row[x >> 3] |= 0x80 >> (x & 7);
+      }
+    }
+  }
+  return f;
+}
+
+//=============================================================================
+#endif
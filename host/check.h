@@ -0,0 +1,40 @@
+#ifndef __HOST_CHECK_H__
+#define __HOST_CHECK_H__
+//=============================================================================
+// Host tests: CHECK() reports a failed condition and carries on, main()
+// returns checkResult() so make sees the failure.
+//=============================================================================
+#include <stdio.h>
+
+static unsigned check_failures = 0;
+
+#define CHECK(condition) \
+  do \
+  { \
+    if (!(condition)) \
+    { \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition); \
+      check_failures++; \
+    } \
+  } while (0)
+
+#define CHECK_EQ(a, b) \
+  do \
+  { \
+    long long a_ = (long long)(a); \
+    long long b_ = (long long)(b); \
+    if (a_ != b_) \
+    { \
+      printf("%s:%d: %s == %s failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, a_, b_); \
+      check_failures++; \
+    } \
+  } while (0)
+
+static inline int checkResult(const char *name)
+{
+  printf("%s: %s\n", name, check_failures ? "FAILED" : "ok");
+  return check_failures ? 1 : 0;
+}
+
+//=============================================================================
+#endif
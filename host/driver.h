@@ -0,0 +1,62 @@
+#ifndef __HOST_DRIVER_H__
+#define __HOST_DRIVER_H__
+//=============================================================================
+// Host build: the driver headers in the order the sketch includes them,
+// with the sketch's panel typedefs, for tests that drive them directly.
+// Options (EPD_BUS_STATS, EPD_TIMING, ...) go on the command line or ahead
+// of the #include.
+//=============================================================================
+#include <Arduino.h>
+#include <SPI.h>
+#include <SD.h>
+#include "emulator.h"
+
+#include "LUTs_for_CFAP104212E00213.h"
+#include "Images_for_CFAP104212E00213.h"
+
+#define EPD_READY 3
+#define EPD_RESET 4
+#define EPD_DC    5
+#define EPD_CS    10
+
+#include "Bus_for_CFAP104212E00213.h"
+typedef ePaperBus<EPD_CS, EPD_DC, EPD_RESET, EPD_READY> EPD;
+
+#include "Timing_for_CFAP104212E00213.h"
+#include "Async_for_CFAP104212E00213.h"
+typedef ePaperAsync<EPD> EPDAsync;
+#include "Convert_for_CFAP104212E00213.h"
+#include "Partial_for_CFAP104212E00213.h"
+#include "Packed_for_CFAP104212E00213.h"
+#include "Orient_for_CFAP104212E00213.h"
+#include "Text_for_CFAP104212E00213.h"
+#include "Fonts_for_CFAP104212E00213.h"
+#include "Render_for_CFAP104212E00213.h"
+#include "Pattern_for_CFAP104212E00213.h"
+#include "BMP_for_CFAP104212E00213.h"
+#include "Cache_for_CFAP104212E00213.h"
+
+#include "LUTManager_for_CFAP104212E00213.h"
+typedef ePaperLUT<EPD> EPDLUT;
+#include "Temperature_for_CFAP104212E00213.h"
+typedef ePaperTemperature<EPD> EPDTemp;
+#include "Panel_for_CFAP104212E00213.h"
+typedef ePaperPanel<EPD> EPDPanel;
+#include "Power_for_CFAP104212E00213.h"
+typedef ePaperPower<EPDPanel> EPDPower;
+#include "Upload_for_CFAP104212E00213.h"
+
+//A panel on the sketch's pins, reset and powered up as setup() leaves it
+static inline EmuController &hostPanel(void)
+{
+  emu.clear();
+  EmuController &panel = emu.addPanel(EPD_CS, EPD_DC, EPD_RESET, EPD_READY);
+  EPDPanel::begin();
+  SPI.begin();
+  EPDPanel::reset();
+  EPDPanel::init();
+  return panel;
+}
+
+//=============================================================================
+#endif
@@ -0,0 +1,708 @@
+//=============================================================================
+// Host build of the CFAP104212E0-0213 example: controller model and the
+// Arduino core functions that drive it. See emulator.h.
+//=============================================================================
+#include "emulator.h"
+#include <Arduino.h>
+#include <SPI.h>
+#include <SD.h>
+
+Emulator emu;
+HardwareSerial Serial;
+SPIClass SPI;
+SDClass SD;
+
+static const uint64_t NEVER = ~(uint64_t)0;
+
+//=============================================================================
+EmuController::EmuController(uint8_t cs, uint8_t dc, uint8_t reset, uint8_t busy)
+  : cs_pin(cs), dc_pin(dc), reset_pin(reset), busy_pin(busy),
+    temperature(22), stuck_busy(false), no_busy(false), errors(0),
+    edge_pending(false), busy_until(0), in_reset(false)
+{
+  memset(ram, 0, sizeof(ram));
+  memset(glass, 0, sizeof(glass));
+  hardReset();
+}
+
+void EmuController::hardReset(void)
+{
+  panel_setting = 0x0f;
+  memset(power_setting, 0, sizeof(power_setting));
+  memset(booster, 0, sizeof(booster));
+  memset(resolution, 0, sizeof(resolution));
+  //50 Hz
+  pll = 0x3c;
+  vcom = 0;
+  cdi = 0;
+  memset(lut, 0, sizeof(lut));
+  memset(lut_bytes, 0, sizeof(lut_bytes));
+  powered = false;
+  asleep = false;
+  partial = false;
+  glass_bw_only = false;
+  xb1 = 0;
+  xb2 = EMU_ROW_BYTES - 1;
+  y1 = 0;
+  y2 = EMU_VRES - 1;
+  current = 0xff;
+  index = 0;
+  read_bit = -1;
+  read_buffer[0] = 0;
+  read_buffer[1] = 0;
+}
+
+bool EmuController::busyLevel(uint64_t now) const
+{
+  if (in_reset)
+  {
+    return false;
+  }
+  return busy_until <= now;
+}
+
+uint32_t EmuController::refreshFrames(void) const
+{
+  if ((panel_setting & 0x20) && (lut_bytes[0] != 0))
+  {
+    //register waveform: 7 groups of level, four phase lengths, repeat
+    uint32_t frames = 0;
+    for (uint8_t g = 0; g < 7; g++)
+    {
+      const uint8_t *group = &lut[0][g * 6];
+      frames += (uint32_t)(group[1] + group[2] + group[3] + group[4]) * group[5];
+    }
+    return frames;
+  }
+  return (panel_setting & 0x10) ? EMU_OTP_BW_FRAMES : EMU_OTP_TRICOLOR_FRAMES;
+}
+
+uint32_t EmuController::frameRate(void) const
+{
+  switch (pll)
+  {
+    case 0x3c: return 50;
+    case 0x3a: return 100;
+    case 0x29: return 150;
+    case 0x31: return 171;
+    case 0x39: return 200;
+  }
+  return 50;
+}
+
+uint8_t EmuController::pixel(uint16_t x, uint16_t y) const
+{
+  uint8_t mask = 0x80 >> (x & 7);
+  bool bw = glass[0][y][x >> 3] & mask;
+  bool y_bit = glass[1][y][x >> 3] & mask;
+  if (glass_bw_only)
+  {
+    //B/W mode: 0x13 holds the NEW image
+    return y_bit ? 1 : 0;
+  }
+  if (y_bit)
+  {
+    return 2;
+  }
+  return bw ? 1 : 0;
+}
+
+bool EmuController::writePPM(const char *path) const
+{
+  FILE *f = fopen(path, "wb");
+  if (!f)
+  {
+    return false;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", EMU_HRES, EMU_VRES);
+  static const uint8_t colour[3][3] = { { 255, 255, 255 }, { 0, 0, 0 }, { 255, 210, 0 } };
+  for (uint16_t y = 0; y < EMU_VRES; y++)
+  {
+    for (uint16_t x = 0; x < EMU_HRES; x++)
+    {
+      fwrite(colour[pixel(x, y)], 1, 3, f);
+    }
+  }
+  return 0 == fclose(f);
+}
+
+void EmuController::error(const char *what)
+{
+  errors++;
+  char line[96];
+  snprintf(line, sizeof(line), "CS%u cmd %02X: %s\n", cs_pin, current, what);
+  error_log += line;
+}
+
+void EmuController::csFall(void)
+{
+  stats.cs_edges++;
+}
+
+void EmuController::csRise(void)
+{
+}
+
+void EmuController::resetPin(uint8_t level, uint64_t now)
+{
+  if (level == LOW)
+  {
+    in_reset = true;
+    hardReset();
+    edge_pending = false;
+    busy_until = NEVER;
+  }
+  else if (in_reset)
+  {
+    in_reset = false;
+    busy_until = now;
+    startBusy(emu.timing.reset, now);
+  }
+}
+
+void EmuController::startBusy(uint64_t ns, uint64_t now)
+{
+  if (no_busy)
+  {
+    busy_until = now;
+    edge_pending = false;
+    return;
+  }
+  edge_pending = true;
+  if (stuck_busy)
+  {
+    busy_until = NEVER;
+    return;
+  }
+  busy_until = now + ns;
+  stats.busy_ns += ns;
+}
+
+void EmuController::byte(uint8_t value, bool is_data, uint64_t now)
+{
+  stats.bytes++;
+  if (in_reset)
+  {
+    error("byte during reset");
+    return;
+  }
+  if (!busyLevel(now))
+  {
+    error("byte while busy");
+  }
+  if (!is_data)
+  {
+    command(value, now);
+  }
+  else
+  {
+    data(value);
+  }
+}
+
+void EmuController::command(uint8_t c, uint64_t now)
+{
+  stats.commands++;
+  command_log.push_back(c);
+  current = c;
+  index = 0;
+  if (asleep)
+  {
+    error("command in deep sleep");
+    return;
+  }
+  switch (c)
+  {
+    case 0x02:
+      startBusy(emu.timing.power_off, now);
+      powered = false;
+      break;
+    case 0x04:
+      startBusy(emu.timing.power_on, now);
+      powered = true;
+      break;
+    case 0x12:
+      refresh(now);
+      break;
+    case 0x40:
+      startBusy(emu.timing.tsc, now);
+      read_buffer[0] = (uint8_t)temperature;
+      read_buffer[1] = 0;
+      read_bit = -1;
+      break;
+    case 0x91:
+      partial = true;
+      break;
+    case 0x92:
+      partial = false;
+      break;
+    case 0x00: case 0x01: case 0x06: case 0x07: case 0x10: case 0x11:
+    case 0x13: case 0x20: case 0x21: case 0x22: case 0x23: case 0x24:
+    case 0x30: case 0x50: case 0x61: case 0x82: case 0x90:
+      break;
+    default:
+      error("unknown command");
+      break;
+  }
+}
+
+void EmuController::data(uint8_t d)
+{
+  uint16_t i = index++;
+  switch (current)
+  {
+    case 0x00:
+      if (i == 0)
+      {
+        panel_setting = d;
+        return;
+      }
+      break;
+    case 0x01:
+      if (i < sizeof(power_setting))
+      {
+        power_setting[i] = d;
+        return;
+      }
+      break;
+    case 0x06:
+      if (i < sizeof(booster))
+      {
+        booster[i] = d;
+        return;
+      }
+      break;
+    case 0x07:
+      if ((i == 0) && (d == 0xa5))
+      {
+        asleep = true;
+        powered = false;
+        return;
+      }
+      break;
+    case 0x10:
+    case 0x13:
+    {
+      uint8_t plane = (current == 0x13);
+      uint16_t width = partial ? (xb2 - xb1 + 1) : EMU_ROW_BYTES;
+      uint16_t row = (partial ? y1 : 0) + i / width;
+      uint16_t column = (partial ? xb1 : 0) + i % width;
+      if (row <= (partial ? y2 : EMU_VRES - 1))
+      {
+        ram[plane][row][column] = d;
+        return;
+      }
+      error("plane data past the window");
+      return;
+    }
+    case 0x20: case 0x21: case 0x22: case 0x23: case 0x24:
+      if (i < sizeof(lut[0]))
+      {
+        lut[current - 0x20][i] = d;
+        lut_bytes[current - 0x20] = i + 1;
+        return;
+      }
+      break;
+    case 0x30:
+      if (i == 0)
+      {
+        pll = d;
+        return;
+      }
+      break;
+    case 0x50:
+      if (i == 0)
+      {
+        cdi = d;
+        return;
+      }
+      break;
+    case 0x61:
+      if (i < sizeof(resolution))
+      {
+        resolution[i] = d;
+        return;
+      }
+      break;
+    case 0x82:
+      if (i == 0)
+      {
+        vcom = d;
+        return;
+      }
+      break;
+    case 0x90:
+      if (i < sizeof(window))
+      {
+        window[i] = d;
+        if (i == sizeof(window) - 1)
+        {
+          uint8_t x_start = window[0] >> 3;
+          uint8_t x_end = window[1] >> 3;
+          uint16_t y_start = ((uint16_t)window[2] << 8) | window[3];
+          uint16_t y_end = ((uint16_t)window[4] << 8) | window[5];
+          if ((x_end < x_start) || (EMU_ROW_BYTES <= x_end) ||
+              (y_end < y_start) || (EMU_VRES <= y_end))
+          {
+            error("window outside the panel");
+            return;
+          }
+          xb1 = x_start;
+          xb2 = x_end;
+          y1 = y_start;
+          y2 = y_end;
+        }
+        return;
+      }
+      break;
+  }
+  error("unexpected data byte");
+}
+
+void EmuController::refresh(uint64_t now)
+{
+  if (!powered)
+  {
+    error("refresh while powered off");
+  }
+  glass_bw_only = (panel_setting & 0x10) != 0;
+  for (uint8_t plane = 0; plane < 2; plane++)
+  {
+    for (uint16_t y = 0; y < EMU_VRES; y++)
+    {
+      for (uint8_t xb = 0; xb < EMU_ROW_BYTES; xb++)
+      {
+        if (!partial || ((xb1 <= xb) && (xb <= xb2) && (y1 <= y) && (y <= y2)))
+        {
+          glass[plane][y][xb] = ram[plane][y][xb];
+        }
+      }
+    }
+  }
+  if (partial)
+  {
+    stats.partial_refreshes++;
+  }
+  else
+  {
+    stats.refreshes++;
+  }
+  startBusy((uint64_t)refreshFrames() * 1000000000ULL / frameRate(), now);
+}
+
+void EmuController::clockOut(void)
+{
+  if (read_bit < 15)
+  {
+    read_bit++;
+  }
+}
+
+uint8_t EmuController::readBit(void) const
+{
+  if (read_bit < 0)
+  {
+    return 0;
+  }
+  return (read_buffer[read_bit >> 3] >> (7 - (read_bit & 7))) & 1;
+}
+
+//=============================================================================
+Emulator::Emulator()
+{
+  clear();
+}
+
+Emulator::~Emulator()
+{
+  clear();
+}
+
+void Emulator::clear(void)
+{
+  for (size_t i = 0; i < controllers.size(); i++)
+  {
+    delete controllers[i];
+  }
+  controllers.clear();
+  now_ns = 0;
+  delay_ns = 0;
+  memset(level, 0, sizeof(level));
+  memset(mode, INPUT, sizeof(mode));
+  //D2 and D3 have external interrupts, as on the Uno
+  interrupts = true;
+  irq_enabled = true;
+  isr[0] = 0;
+  isr[1] = 0;
+  spi_hz = cost.max_spi_hz;
+  bus_conflicts = 0;
+  record_pins = false;
+  pin_events.clear();
+  in_isr = false;
+}
+
+EmuController &Emulator::addPanel(uint8_t cs, uint8_t dc, uint8_t reset, uint8_t busy)
+{
+  controllers.push_back(new EmuController(cs, dc, reset, busy));
+  //deselected until the sketch drives CS
+  level[cs] = HIGH;
+  level[reset] = HIGH;
+  return *controllers.back();
+}
+
+EmuController *Emulator::panel(uint8_t cs)
+{
+  for (size_t i = 0; i < controllers.size(); i++)
+  {
+    if (controllers[i]->cs_pin == cs)
+    {
+      return controllers[i];
+    }
+  }
+  return 0;
+}
+
+void Emulator::advance(uint64_t ns)
+{
+  now_ns += ns;
+  fireEdges();
+}
+
+void Emulator::fireEdges(void)
+{
+  if (!irq_enabled || in_isr)
+  {
+    return;
+  }
+  for (size_t i = 0; i < controllers.size(); i++)
+  {
+    EmuController &c = *controllers[i];
+    if (c.edge_pending && (c.busy_until <= now_ns))
+    {
+      c.edge_pending = false;
+      int irq = digitalPinToInterrupt(c.busy_pin);
+      if ((0 <= irq) && isr[irq])
+      {
+        in_isr = true;
+        isr[irq]();
+        in_isr = false;
+      }
+    }
+  }
+}
+
+void Emulator::setInterrupts(bool enabled)
+{
+  irq_enabled = enabled;
+  fireEdges();
+}
+
+void Emulator::pinMode(uint8_t pin, uint8_t pin_mode)
+{
+  advance(cost.pin_write_ns);
+  mode[pin] = pin_mode;
+}
+
+void Emulator::write(uint8_t pin, uint8_t value)
+{
+  advance(cost.pin_write_ns);
+  value = value ? HIGH : LOW;
+  uint8_t was = level[pin];
+  level[pin] = value;
+  if (record_pins && (was != value))
+  {
+    EmuPinEvent e = { now_ns, pin, value };
+    pin_events.push_back(e);
+  }
+  if (was == value)
+  {
+    return;
+  }
+  for (size_t i = 0; i < controllers.size(); i++)
+  {
+    EmuController &c = *controllers[i];
+    if (pin == c.cs_pin)
+    {
+      if (value == LOW)
+      {
+        c.csFall();
+      }
+      else
+      {
+        c.csRise();
+      }
+    }
+    if (pin == c.reset_pin)
+    {
+      c.resetPin(value, now_ns);
+    }
+  }
+  //reads clock the controller's data line out on the rising SCK edge
+  if ((pin == SCK) && (value == HIGH) && (mode[MOSI] == INPUT))
+  {
+    EmuController *c = selected();
+    if (c)
+    {
+      c->clockOut();
+    }
+  }
+}
+
+uint8_t Emulator::read(uint8_t pin)
+{
+  advance(cost.pin_read_ns);
+  for (size_t i = 0; i < controllers.size(); i++)
+  {
+    if (pin == controllers[i]->busy_pin)
+    {
+      return controllers[i]->busyLevel(now_ns) ? HIGH : LOW;
+    }
+  }
+  if ((pin == MOSI) && (mode[MOSI] == INPUT))
+  {
+    EmuController *c = selected();
+    return c ? c->readBit() : LOW;
+  }
+  return level[pin];
+}
+
+EmuController *Emulator::selected(void)
+{
+  EmuController *found = 0;
+  for (size_t i = 0; i < controllers.size(); i++)
+  {
+    if (level[controllers[i]->cs_pin] == LOW)
+    {
+      if (found)
+      {
+        return 0;
+      }
+      found = controllers[i];
+    }
+  }
+  return found;
+}
+
+uint8_t Emulator::spi(uint8_t value)
+{
+  uint64_t ns = 8000000000ULL / spi_hz + cost.spi_byte_ns;
+  advance(ns);
+  EmuController *c = selected();
+  if (!c)
+  {
+    bus_conflicts++;
+    return 0;
+  }
+  c->stats.transfer_ns += ns;
+  c->byte(value, level[c->dc_pin] == HIGH, now_ns);
+  //nothing drives MISO
+  return 0;
+}
+
+//=============================================================================
+// The Arduino core on top of the emulator
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  emu.pinMode(pin, mode);
+}
+
+void digitalWrite(uint8_t pin, uint8_t level)
+{
+  emu.write(pin, level);
+}
+
+int digitalRead(uint8_t pin)
+{
+  return emu.read(pin);
+}
+
+unsigned long micros(void)
+{
+  emu.advance(emu.cost.micros_ns);
+  return (unsigned long)(emu.now_ns / 1000ULL);
+}
+
+unsigned long millis(void)
+{
+  emu.advance(emu.cost.micros_ns);
+  return (unsigned long)(emu.now_ns / 1000000ULL);
+}
+
+void delay(unsigned long ms)
+{
+  emu.delay_ns += (uint64_t)ms * 1000000ULL;
+  emu.advance((uint64_t)ms * 1000000ULL);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  emu.delay_ns += (uint64_t)us * 1000ULL;
+  emu.advance((uint64_t)us * 1000ULL);
+}
+
+int digitalPinToInterrupt(uint8_t pin)
+{
+  if (!emu.interrupts)
+  {
+    return -1;
+  }
+  return (pin == 2) ? 0 : ((pin == 3) ? 1 : -1);
+}
+
+void attachInterrupt(uint8_t irq, void (*isr)(void), int mode)
+{
+  //BUSY only ever uses RISING
+  if ((irq < 2) && (mode == RISING))
+  {
+    emu.isr[irq] = isr;
+  }
+}
+
+void detachInterrupt(uint8_t irq)
+{
+  if (irq < 2)
+  {
+    emu.isr[irq] = 0;
+  }
+}
+
+void noInterrupts(void)
+{
+  emu.setInterrupts(false);
+}
+
+void interrupts(void)
+{
+  emu.setInterrupts(true);
+}
+
+void SPIClass::begin(void)
+{
+}
+
+void SPIClass::end(void)
+{
+}
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+  emu.spi_hz = (settings.clock < emu.cost.max_spi_hz) ? settings.clock : emu.cost.max_spi_hz;
+}
+
+void SPIClass::endTransaction(void)
+{
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  return emu.spi(data);
+}
+
+void SPIClass::transfer(void *buffer, size_t n)
+{
+  uint8_t *p = (uint8_t *)buffer;
+  for (size_t i = 0; i < n; i++)
+  {
+    p[i] = emu.spi(p[i]);
+  }
+}
@@ -0,0 +1,235 @@
+#ifndef __HOST_EMULATOR_H__
+#define __HOST_EMULATOR_H__
+//=============================================================================
+// Host build of the CFAP104212E0-0213 example: a model of the IL0373 class
+// controller on the other end of the bus.
+//
+// The Arduino stubs (stubs/) route every pin write, pin read and SPI byte
+// here. Each EmuController watches its own CS, DC, RESET and BUSY pins and
+// decodes what it is sent:
+//
+//   0x00 Panel Setting        0x01 Power Setting     0x02 Power Off
+//   0x04 Power On             0x06 Booster           0x07 Deep Sleep
+//   0x10 BW plane             0x11 Data Stop         0x12 Refresh
+//   0x13 yellow plane         0x20-0x24 LUTs         0x30 PLL
+//   0x40 TSC                  0x50 CDI               0x61 Resolution
+//   0x82 VCOM_DC              0x90 Partial Window    0x91/0x92 Partial In/Out
+//
+// Anything else, or anything sent out of order (a refresh while powered
+// off, a command while asleep), is counted in errors and described in
+// error_log.
+//
+// Time is virtual, in nanoseconds. It only moves when the sketch does
+// something that takes time on the real board, at the rates in
+// Emulator::cost. BUSY is held low for a modeled time after each command
+// that makes the controller work; a refresh lasts the waveform's frames at
+// the PLL frame rate (register LUTs are summed from 0x20, the OTP
+// waveforms use EMU_OTP_*_FRAMES). A BUSY pin with an external interrupt
+// fires its handler on the rising edge, from inside whatever stub call
+// moves time past it.
+//=============================================================================
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#define EMU_HRES      (104)
+#define EMU_VRES      (212)
+#define EMU_ROW_BYTES (EMU_HRES / 8)
+#define EMU_PINS      (32)
+
+//Frames in the OTP waveforms. Not in the datasheet: chosen so a tri-color
+//refresh at 100 Hz takes the 15 s the panel is specified for.
+#define EMU_OTP_TRICOLOR_FRAMES (1500)
+#define EMU_OTP_BW_FRAMES       (300)
+
+//Counters for one controller, all since the last clear()
+struct EmuStats
+{
+  uint32_t bytes;
+  uint32_t commands;
+  //falling edges of CS
+  uint32_t cs_edges;
+  uint32_t refreshes;
+  uint32_t partial_refreshes;
+  //time spent clocking bytes in, and with BUSY low
+  uint64_t transfer_ns;
+  uint64_t busy_ns;
+
+  void clear(void) { *this = EmuStats(); }
+  EmuStats() : bytes(0), commands(0), cs_edges(0), refreshes(0),
+               partial_refreshes(0), transfer_ns(0), busy_ns(0) {}
+};
+
+//Modeled durations, in nanoseconds
+struct EmuTiming
+{
+  uint64_t power_on;
+  uint64_t power_off;
+  uint64_t tsc;
+  uint64_t reset;
+
+  EmuTiming() : power_on(80000000ULL), power_off(20000000ULL),
+                tsc(5000000ULL), reset(1000000ULL) {}
+};
+
+class EmuController
+{
+public:
+  uint8_t cs_pin;
+  uint8_t dc_pin;
+  uint8_t reset_pin;
+  uint8_t busy_pin;
+
+  //Image RAM (0 = 0x10, 1 = 0x13) and what the last refresh put on the glass
+  uint8_t ram[2][EMU_VRES][EMU_ROW_BYTES];
+  uint8_t glass[2][EMU_VRES][EMU_ROW_BYTES];
+
+  //Registers as last written
+  uint8_t panel_setting;
+  uint8_t power_setting[5];
+  uint8_t booster[3];
+  uint8_t resolution[3];
+  uint8_t pll;
+  uint8_t vcom;
+  uint8_t cdi;
+  uint8_t lut[5][44];
+  uint8_t lut_bytes[5];
+  bool    powered;
+  bool    asleep;
+  bool    partial;
+  //the glass was last refreshed in B/W mode (Panel Setting bit 4)
+  bool    glass_bw_only;
+  //Partial window, byte columns and rows, inclusive
+  uint8_t  xb1;
+  uint8_t  xb2;
+  uint16_t y1;
+  uint16_t y2;
+
+  //TSC reading, whole degrees C
+  int8_t temperature;
+  //Faults: BUSY never goes high again, or never goes low at all
+  bool stuck_busy;
+  bool no_busy;
+
+  EmuStats stats;
+  uint32_t errors;
+  std::string error_log;
+  //Every command byte, in order
+  std::vector<uint8_t> command_log;
+
+  EmuController(uint8_t cs, uint8_t dc, uint8_t reset, uint8_t busy);
+
+  //Power-on state, as after RESET
+  void hardReset(void);
+
+  //BUSY pin level, low while working
+  bool busyLevel(uint64_t now) const;
+  //Frames the next refresh runs and the frame rate the PLL gives
+  uint32_t refreshFrames(void) const;
+  uint32_t frameRate(void) const;
+
+  //Panel pixel on the glass: EPD_WHITE, EPD_BLACK or EPD_YELLOW numbering
+  uint8_t pixel(uint16_t x, uint16_t y) const;
+  bool writePPM(const char *path) const;
+
+  //Bus events, from the stubs
+  void csFall(void);
+  void csRise(void);
+  void resetPin(uint8_t level, uint64_t now);
+  void byte(uint8_t value, bool data, uint64_t now);
+  void clockOut(void);
+  uint8_t readBit(void) const;
+
+  //Busy period still to be reported as a rising edge
+  bool     edge_pending;
+  uint64_t busy_until;
+
+private:
+  void command(uint8_t c, uint64_t now);
+  void data(uint8_t d);
+  void startBusy(uint64_t ns, uint64_t now);
+  void refresh(uint64_t now);
+  void error(const char *what);
+
+  uint8_t  current;
+  uint16_t index;
+  bool     in_reset;
+  uint8_t  window[7];
+  //TSC bytes being clocked out, and the bit on the line
+  uint8_t  read_buffer[2];
+  int8_t   read_bit;
+};
+
+struct EmuPinEvent
+{
+  uint64_t ns;
+  uint8_t  pin;
+  uint8_t  level;
+};
+
+//What time costs on an ATmega328P at 16 MHz
+struct EmuCost
+{
+  //per byte on top of the SPI clock: loading SPDR
+  uint32_t spi_byte_ns;
+  //a FastPin write, and a pin read with the loop around it
+  uint32_t pin_write_ns;
+  uint32_t pin_read_ns;
+  uint32_t micros_ns;
+  //the fastest SPI clock the board can make
+  uint32_t max_spi_hz;
+
+  EmuCost() : spi_byte_ns(125), pin_write_ns(125), pin_read_ns(1000),
+              micros_ns(4000), max_spi_hz(8000000UL) {}
+};
+
+class Emulator
+{
+public:
+  uint64_t now_ns;
+  //time spent in delay() and delayMicroseconds()
+  uint64_t delay_ns;
+  uint8_t  level[EMU_PINS];
+  uint8_t  mode[EMU_PINS];
+  //false makes every pin report no interrupt, so BUSY is polled
+  bool     interrupts;
+  bool     irq_enabled;
+  void   (*isr[2])(void);
+  uint32_t spi_hz;
+  //bytes clocked while no controller, or more than one, was selected
+  uint32_t bus_conflicts;
+  EmuTiming timing;
+  EmuCost   cost;
+
+  //Pin transition recorder, off until record_pins is set
+  bool record_pins;
+  std::vector<EmuPinEvent> pin_events;
+
+  std::vector<EmuController *> controllers;
+
+  Emulator();
+  ~Emulator();
+
+  //Forget everything: pins, time, controllers, recordings
+  void clear(void);
+  EmuController &addPanel(uint8_t cs, uint8_t dc, uint8_t reset, uint8_t busy);
+  EmuController *panel(uint8_t cs);
+
+  void advance(uint64_t ns);
+  void pinMode(uint8_t pin, uint8_t mode);
+  void write(uint8_t pin, uint8_t level);
+  uint8_t read(uint8_t pin);
+  uint8_t spi(uint8_t value);
+  void setInterrupts(bool enabled);
+
+private:
+  void fireEdges(void);
+  EmuController *selected(void);
+
+  bool in_isr;
+};
+
+extern Emulator emu;
+
+//=============================================================================
+#endif
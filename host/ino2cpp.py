@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+#==============================================================================
+# Turn the sketch into a C++ file the host compiler takes, the way the
+# Arduino IDE does: #include <Arduino.h> first, then a prototype for every
+# function ahead of the first definition so they can be called before they
+# are defined.
+#
+#   ino2cpp.py SKETCH.ino OUT.cpp [--set NAME=VALUE ...]
+#
+# --set replaces the value of a "#define NAME value" line of the sketch, to
+# turn demos and options on or off for a host build without editing it.
+#==============================================================================
+import argparse
+import re
+import sys
+
+FUNCTION = re.compile(r'^([A-Za-z_][\w\s\*&:<>,]*?[\s\*&]+)([A-Za-z_]\w*)\s*\(([^;]*)\)\s*$')
+NOT_A_FUNCTION = ('#', '//', 'template', 'else', 'return')
+
+
+def strip(line):
+    """A line without its comment and string or character literals."""
+    line = re.sub(r'//.*', '', line)
+    line = re.sub(r'"(\\.|[^"])*"', '', line)
+    return re.sub(r"'(\\.|[^'])*'", '', line)
+
+
+def prototypes(lines):
+    """Prototypes of the top level functions and the index of the first."""
+    found = []
+    first = None
+    depth = 0
+    for i, line in enumerate(lines):
+        if depth == 0 and not line.startswith(NOT_A_FUNCTION):
+            m = FUNCTION.match(line)
+            if m and i + 1 < len(lines) and lines[i + 1].strip().startswith('{'):
+                found.append(line.strip() + ';')
+                if first is None:
+                    first = i
+        s = strip(line)
+        depth += s.count('{') - s.count('}')
+    return found, first
+
+
+def apply_settings(lines, settings):
+    left = dict(settings)
+    for i, line in enumerate(lines):
+        m = re.match(r'^#define\s+(\w+)\b', line)
+        if m and m.group(1) in left:
+            lines[i] = '#define %s %s' % (m.group(1), left.pop(m.group(1)))
+    if left:
+        sys.exit('ino2cpp: no #define for %s' % ', '.join(sorted(left)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a sketch to C++ for a host build.')
+    parser.add_argument('sketch')
+    parser.add_argument('output')
+    parser.add_argument('--set', action='append', default=[], metavar='NAME=VALUE')
+    args = parser.parse_args()
+
+    settings = []
+    for s in args.set:
+        name, _, value = s.partition('=')
+        settings.append((name, value))
+
+    #the sketch has a few Windows-1252 characters in its comments
+    with open(args.sketch, encoding='latin-1') as f:
+        lines = f.read().split('\n')
+    apply_settings(lines, settings)
+    found, first = prototypes(lines)
+    if first is None:
+        sys.exit('ino2cpp: no functions in %s' % args.sketch)
+
+    out = ['#include <Arduino.h>', '#line 1 "%s"' % args.sketch]
+    out += lines[:first]
+    out += found
+    out += ['#line %d "%s"' % (first + 1, args.sketch)]
+    out += lines[first:]
+    with open(args.output, 'w', encoding='latin-1') as f:
+        f.write('\n'.join(out))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,181 @@
+#ifndef __HOST_ARDUINO_H__
+#define __HOST_ARDUINO_H__
+//=============================================================================
+// Host build of the CFAP104212E0-0213 example: the part of the Arduino core
+// the sketch uses. Pins, time and interrupts are provided by the controller
+// emulator (see ../emulator.h), so the sketch runs unchanged against a model
+// of the panel.
+//=============================================================================
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+//Flash is ordinary memory on the host
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+#define pgm_read_ptr(p) (*(const void * const *)(p))
+#define memcpy_P memcpy
+#define strcmp_P strcmp
+#define strlen_P strlen
+
+#ifndef _BV
+#define _BV(bit) (1 << (bit))
+#endif
+
+#define HIGH (1)
+#define LOW  (0)
+
+#define INPUT        (0)
+#define OUTPUT       (1)
+#define INPUT_PULLUP (2)
+
+#define CHANGE  (1)
+#define FALLING (2)
+#define RISING  (3)
+
+#define DEC (10)
+#define HEX (16)
+
+#define MSBFIRST  (1)
+#define SPI_MODE0 (0)
+
+//Uno SPI pins
+static const uint8_t SS   = 10;
+static const uint8_t MOSI = 11;
+static const uint8_t MISO = 12;
+static const uint8_t SCK  = 13;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+//D2 and D3 have external interrupts, as on the Uno, unless the emulator is
+//told to poll every pin (see Emulator::interrupts)
+int digitalPinToInterrupt(uint8_t pin);
+void attachInterrupt(uint8_t irq, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t irq);
+void noInterrupts(void);
+void interrupts(void);
+#define cli() noInterrupts()
+#define sei() interrupts()
+
+//Defined by a host program that builds the sketch with
+//-DEPD_HOST_REPORT=hostReport, see ../bench.cpp
+void hostReport(const char *label);
+
+static inline char *utoa(unsigned value, char *buffer, int radix)
+{
+  sprintf(buffer, (radix == 16) ? "%x" : "%u", value);
+  return buffer;
+}
+
+//=============================================================================
+// Print and Stream, enough for Serial and the upload receiver
+class Print
+{
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *data, size_t n)
+  {
+    for (size_t i = 0; i < n; i++)
+    {
+      write(data[i]);
+    }
+    return n;
+  }
+
+  size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(unsigned char v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(int v, int base = DEC) { return print((long)v, base); }
+  size_t print(unsigned v, int base = DEC) { return print((unsigned long)v, base); }
+  size_t print(long v, int base = DEC)
+  {
+    char s[24];
+    snprintf(s, sizeof(s), (base == HEX) ? "%lx" : "%ld", v);
+    return print(s);
+  }
+  size_t print(unsigned long v, int base = DEC)
+  {
+    char s[24];
+    snprintf(s, sizeof(s), (base == HEX) ? "%lx" : "%lu", v);
+    return print(s);
+  }
+  size_t print(double v, int digits = 2)
+  {
+    char s[32];
+    snprintf(s, sizeof(s), "%.*f", digits, v);
+    return print(s);
+  }
+
+  size_t println(void) { return print("\r\n"); }
+  template<class T> size_t println(T v) { return print(v) + println(); }
+  template<class T> size_t println(T v, int base) { return print(v, base) + println(); }
+};
+
+class Stream : public Print
+{
+public:
+  virtual int available(void) = 0;
+  virtual int read(void) = 0;
+};
+
+//Output is collected in out (and echoed to stdout if echo is set), input
+//is whatever a test puts in in
+class HardwareSerial : public Stream
+{
+public:
+  std::string out;
+  std::string in;
+  bool echo;
+
+  HardwareSerial() : echo(false) {}
+
+  void begin(unsigned long) {}
+  void end(void) {}
+  void flush(void) {}
+  operator bool() const { return true; }
+
+  using Print::write;
+  size_t write(uint8_t c)
+  {
+    out += (char)c;
+    if (echo)
+    {
+      putchar(c);
+    }
+    return 1;
+  }
+  int available(void) { return (int)in.size(); }
+  int read(void)
+  {
+    if (in.empty())
+    {
+      return -1;
+    }
+    uint8_t c = in[0];
+    in.erase(0, 1);
+    return c;
+  }
+};
+
+extern HardwareSerial Serial;
+
+//=============================================================================
+#endif
@@ -0,0 +1,276 @@
+#ifndef __HOST_SD_H__
+#define __HOST_SD_H__
+//=============================================================================
+// Host build: an SD card held in memory. Files live in SD.files, keyed by
+// name, and the root directory lists them in name order. A test can make
+// the card fill up after SD.write_budget more bytes to check how writers
+// handle a failed write.
+//
+// Each file has a FAT modify date and time (high and low 16 bits) in
+// SD.modified. A write gives it SD.clock, SD.touch() the next tick, as a PC
+// saving the file again would. The SdFat classes the SD library is built
+// on see them through SdFile::dirEntry().
+//=============================================================================
+#include "Arduino.h"
+#include <map>
+#include <vector>
+
+#define O_READ   (0x01)
+#define O_WRITE  (0x02)
+#define O_APPEND (0x04)
+#define O_CREAT  (0x10)
+#define O_TRUNC  (0x40)
+
+#define FILE_READ  (O_READ)
+#define FILE_WRITE (O_READ | O_WRITE | O_CREAT | O_APPEND)
+
+typedef std::vector<uint8_t> SD_Data;
+
+class File;
+
+class SDClass
+{
+public:
+  std::map<std::string, SD_Data> files;
+  //bytes that can still be written, -1 for no limit
+  long write_budget;
+  //bytes read through every File
+  uint32_t bytes_read;
+  uint32_t bytes_written;
+  std::map<std::string, uint32_t> modified;
+  uint32_t clock;
+
+  SDClass() : write_budget(-1), bytes_read(0), bytes_written(0), clock(0) {}
+
+  void touch(const char *name) { modified[name] = ++clock; }
+
+  bool begin(uint8_t) { return true; }
+  bool begin(uint32_t, uint8_t) { return true; }
+  File open(const char *name, uint8_t mode = FILE_READ);
+  bool exists(const char *name) { return files.count(name) != 0; }
+  bool remove(const char *name) { return files.erase(name) != 0; }
+};
+
+extern SDClass SD;
+
+class File
+{
+public:
+  File() : is_open(false), directory(false), listed(false), position_(0), mode(0) {}
+
+  operator bool() const { return is_open; }
+
+  const char *name(void) const { return directory ? "/" : path.c_str(); }
+  bool isDirectory(void) const { return directory; }
+
+  uint32_t size(void) const
+  {
+    const SD_Data *d = data();
+    return d ? d->size() : 0;
+  }
+  uint32_t position(void) const { return position_; }
+  int available(void) const { return size() - position_; }
+
+  bool seek(uint32_t at)
+  {
+    if (!is_open || directory || (size() < at))
+    {
+      return false;
+    }
+    position_ = at;
+    return true;
+  }
+
+  int read(void *buffer, uint16_t n)
+  {
+    const SD_Data *d = data();
+    if (!d || !(mode & O_READ))
+    {
+      return -1;
+    }
+    uint32_t left = d->size() - position_;
+    if (left < n)
+    {
+      n = left;
+    }
+    memcpy(buffer, d->data() + position_, n);
+    position_ += n;
+    SD.bytes_read += n;
+    return n;
+  }
+  int read(void)
+  {
+    uint8_t c;
+    return (1 == read(&c, 1)) ? c : -1;
+  }
+
+  size_t write(const uint8_t *buffer, size_t n)
+  {
+    SD_Data *d = data();
+    if (!d || !(mode & O_WRITE))
+    {
+      return 0;
+    }
+    if ((0 <= SD.write_budget) && ((size_t)SD.write_budget < n))
+    {
+      //the card is full
+      n = SD.write_budget;
+    }
+    if (0 <= SD.write_budget)
+    {
+      SD.write_budget -= n;
+    }
+    if (mode & O_APPEND)
+    {
+      position_ = d->size();
+    }
+    if (d->size() < position_ + n)
+    {
+      d->resize(position_ + n);
+    }
+    memcpy(d->data() + position_, buffer, n);
+    position_ += n;
+    SD.bytes_written += n;
+    SD.modified[path] = SD.clock;
+    return n;
+  }
+  size_t write(uint8_t c) { return write(&c, 1); }
+
+  void flush(void) {}
+  void close(void) { is_open = false; }
+
+  //Directories: the next file in name order
+  File openNextFile(void)
+  {
+    File f;
+    if (!directory)
+    {
+      return f;
+    }
+    std::map<std::string, SD_Data>::iterator it = SD.files.upper_bound(path);
+    if (listed && (it != SD.files.end()))
+    {
+      f = SD.open(it->first.c_str(), FILE_READ);
+      path = it->first;
+    }
+    else if (!listed && !SD.files.empty())
+    {
+      f = SD.open(SD.files.begin()->first.c_str(), FILE_READ);
+      path = SD.files.begin()->first;
+      listed = true;
+    }
+    return f;
+  }
+
+private:
+  friend class SDClass;
+
+  SD_Data *data(void) const
+  {
+    if (!is_open || directory)
+    {
+      return 0;
+    }
+    std::map<std::string, SD_Data>::iterator it = SD.files.find(path);
+    return (it == SD.files.end()) ? 0 : &it->second;
+  }
+
+  bool is_open;
+  bool directory;
+  bool listed;
+  std::string path;
+  uint32_t position_;
+  uint8_t mode;
+};
+
+inline File SDClass::open(const char *name, uint8_t mode)
+{
+  File f;
+  if (0 == strcmp(name, "/"))
+  {
+    f.is_open = true;
+    f.directory = true;
+    f.listed = false;
+    return f;
+  }
+  if (!exists(name))
+  {
+    if (!(mode & O_CREAT))
+    {
+      return f;
+    }
+    files[name];
+  }
+  if (mode & O_TRUNC)
+  {
+    files[name].clear();
+    modified[name] = clock;
+  }
+  f.is_open = true;
+  f.path = name;
+  f.mode = mode;
+  return f;
+}
+
+//=============================================================================
+// The SdFat classes, enough to mount the card again and read directory
+// entries
+
+#define SPI_HALF_SPEED (1)
+
+struct dir_t
+{
+  uint16_t lastWriteTime;
+  uint16_t lastWriteDate;
+  uint32_t fileSize;
+};
+
+class Sd2Card
+{
+public:
+  uint8_t init(uint8_t, uint8_t) { return true; }
+  uint8_t setSpiClock(uint32_t) { return true; }
+};
+
+class SdVolume
+{
+public:
+  uint8_t init(Sd2Card *) { return true; }
+};
+
+class SdFile
+{
+public:
+  SdFile() : open_(false), root(false) {}
+
+  uint8_t openRoot(SdVolume *) { open_ = root = true; return true; }
+  uint8_t open(SdFile *dir, const char *name, uint8_t)
+  {
+    open_ = dir && dir->root && SD.exists(name);
+    path = name;
+    return open_;
+  }
+  uint8_t isOpen(void) const { return open_; }
+  uint8_t close(void) { open_ = false; return true; }
+
+  uint8_t dirEntry(dir_t *dir)
+  {
+    if (!open_ || root)
+    {
+      return false;
+    }
+    uint32_t stamp = SD.modified[path];
+    dir->lastWriteDate = stamp >> 16;
+    dir->lastWriteTime = stamp & 0xffff;
+    dir->fileSize = SD.files[path].size();
+    return true;
+  }
+
+private:
+  bool open_;
+  bool root;
+  std::string path;
+};
+
+//=============================================================================
+#endif
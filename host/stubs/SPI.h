@@ -0,0 +1,30 @@
+#ifndef __HOST_SPI_H__
+#define __HOST_SPI_H__
+//=============================================================================
+// Host build: SPI bytes go to whichever emulated controller has its chip
+// select low, see ../emulator.h
+//=============================================================================
+#include "Arduino.h"
+
+struct SPISettings
+{
+  uint32_t clock;
+  SPISettings() : clock(4000000UL) {}
+  SPISettings(uint32_t clock_hz, uint8_t, uint8_t) : clock(clock_hz) {}
+};
+
+class SPIClass
+{
+public:
+  void begin(void);
+  void end(void);
+  void beginTransaction(SPISettings settings);
+  void endTransaction(void);
+  uint8_t transfer(uint8_t data);
+  void transfer(void *buffer, size_t n);
+};
+
+extern SPIClass SPI;
+
+//=============================================================================
+#endif
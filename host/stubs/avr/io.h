@@ -0,0 +1,10 @@
+#ifndef __HOST_AVR_IO_H__
+#define __HOST_AVR_IO_H__
+//=============================================================================
+// Host build: no AVR registers. The sketch includes this unconditionally;
+// everything that touches a register is under __AVR__ or its own #ifdef.
+//=============================================================================
+#include "Arduino.h"
+
+//=============================================================================
+#endif
@@ -0,0 +1,101 @@
+//=============================================================================
+// Host test: the job queue finishes a busy period whether BUSY rises with an
+// interrupt, rises without one, never goes low or never comes back high
+//=============================================================================
+#include "driver.h"
+#include "check.h"
+
+static uint8_t callbacks = 0;
+
+static void refreshJob(void *)
+{
+  EPDAsync::refresh();
+}
+
+static void countDone(void *)
+{
+  callbacks++;
+}
+
+//A panel after init(), its BUSY pin interrupt driven or polled
+static EmuController &panel(bool interrupts)
+{
+  emu.clear();
+  emu.interrupts = interrupts;
+  EmuController &c = emu.addPanel(EPD_CS, EPD_DC, EPD_RESET, EPD_READY);
+  EPDPanel::begin();
+  SPI.begin();
+  EPDPanel::reset();
+  EPDPanel::init();
+  return c;
+}
+
+//Milliseconds the queue takes to run two refreshes dry. Limits counted in
+//millis() ticks may end up to a millisecond early.
+static uint32_t twoRefreshes(void)
+{
+  uint64_t start = emu.now_ns;
+  callbacks = 0;
+  CHECK(EPDAsync::submit(refreshJob, 0, countDone));
+  CHECK(EPDAsync::submit(refreshJob, 0, countDone));
+  EPDAsync::waitIdle();
+  CHECK_EQ(callbacks, 2);
+  return (uint32_t)((emu.now_ns - start) / 1000000ULL);
+}
+
+static void testHealthy(bool interrupts, bool lose_edge)
+{
+  EmuController &c = panel(interrupts);
+  if (lose_edge)
+  {
+    //the edge goes nowhere, service() has to notice BUSY is high
+    emu.isr[0] = 0;
+    emu.isr[1] = 0;
+  }
+  uint32_t one = c.refreshFrames() * 1000 / c.frameRate();
+  uint32_t ms = twoRefreshes();
+  CHECK(!EPDAsync::timedOut());
+  CHECK(2 * one <= ms);
+  CHECK(ms < 2 * one + 10);
+  CHECK_EQ(c.stats.refreshes, 2);
+  CHECK_EQ(c.errors, 0);
+}
+
+static void testStuckBusy(bool interrupts)
+{
+  EmuController &c = panel(interrupts);
+  c.stuck_busy = true;
+  uint32_t ms = twoRefreshes();
+  CHECK(EPDAsync::timedOut());
+  CHECK(2 * (EPD_BUSY_TIMEOUT_MS - 1) <= ms);
+  CHECK(ms <= 2 * (EPD_BUSY_TIMEOUT_MS + 1));
+  //a reset brings the controller back
+  c.stuck_busy = false;
+  EPDPanel::reset();
+  EPDPanel::init();
+  ms = twoRefreshes();
+  CHECK(!EPDAsync::timedOut());
+  CHECK(ms < 2 * EPD_BUSY_TIMEOUT_MS);
+}
+
+static void testNoBusy(bool interrupts)
+{
+  EmuController &c = panel(interrupts);
+  c.no_busy = true;
+  uint32_t ms = twoRefreshes();
+  CHECK(!EPDAsync::timedOut());
+  CHECK(2 * (EPD_BUSY_GRACE_MS - 1) <= ms);
+  CHECK(ms <= 2 * (EPD_BUSY_GRACE_MS + 1));
+}
+
+int main(void)
+{
+  for (uint8_t interrupts = 0; interrupts < 2; interrupts++)
+  {
+    testHealthy(interrupts, false);
+    testStuckBusy(interrupts);
+    testNoBusy(interrupts);
+  }
+  testHealthy(true, true);
+  return checkResult("test_async");
+}
@@ -0,0 +1,124 @@
+//=============================================================================
+// Host test: EPD_BUS_STATS counts what the controller receives, and a burst
+// costs one chip select where the sketch used to spend one per byte
+//=============================================================================
+#define EPD_BUS_STATS (1)
+#include "driver.h"
+#include "check.h"
+
+//The counters and the emulator agree
+static void checkCounts(const EmuController &panel, const char *what)
+{
+  if ((EPD::bytes != panel.stats.bytes) || (EPD::cs_assertions != panel.stats.cs_edges))
+  {
+    printf("%s: counted %u bytes / %u cs, emulator saw %u / %u\n", what,
+           EPD::bytes, EPD::cs_assertions, panel.stats.bytes, panel.stats.cs_edges);
+  }
+  CHECK_EQ(EPD::bytes, panel.stats.bytes);
+  CHECK_EQ(EPD::cs_assertions, panel.stats.cs_edges);
+}
+
+static void clearCounts(EmuController &panel)
+{
+  EPD::bytes = 0;
+  EPD::cs_assertions = 0;
+  panel.stats.clear();
+}
+
+static void testPrimitives(void)
+{
+  EmuController &panel = hostPanel();
+  clearCounts(panel);
+
+  EPD::writeCMD(0x11);
+  CHECK_EQ(EPD::bytes, 1);
+  CHECK_EQ(EPD::cs_assertions, 1);
+
+  static const uint8_t flash[5] PROGMEM = { 1, 2, 3, 4, 5 };
+  EPD::writeCMDData_Flash(0x01, flash, sizeof(flash));
+  CHECK_EQ(EPD::bytes, 1 + 1 + 5);
+  CHECK_EQ(EPD::cs_assertions, 2);
+  CHECK_EQ(panel.power_setting[4], 5);
+
+  //longer than EPD_CHUNK, still one chip select
+  uint8_t ram[EPD_CHUNK * 3 + 1];
+  memset(ram, 0xaa, sizeof(ram));
+  EPD::writeCMDData(0x10, ram, sizeof(ram));
+  CHECK_EQ(EPD::cs_assertions, 3);
+  //streamData() leaves its source alone
+  CHECK_EQ(ram[EPD_CHUNK], 0xaa);
+
+  EPD::writeCMDFill(0x13, 0x55, 1000);
+  CHECK_EQ(EPD::cs_assertions, 4);
+  CHECK_EQ(panel.ram[1][0][0], 0x55);
+  checkCounts(panel, "primitives");
+  CHECK_EQ(panel.errors, 0);
+}
+
+static void testFrames(void)
+{
+  EmuController &panel = hostPanel();
+
+  clearCounts(panel);
+  writePatterns<EPD>(solidPattern(0xff), makePattern(PATTERN_CHECKER, 8));
+  checkCounts(panel, "patterns");
+  //two commands and two planes under two chip selects
+  CHECK_EQ(EPD::bytes, 2 + 2 * EPD_PLANE_BYTES);
+
+  clearCounts(panel);
+  loadPackedOriented<EPD>(ROTATE_90, Splash_Mono_Packed, Splash_Yellow_Packed);
+  checkCounts(panel, "rotated");
+
+  clearCounts(panel);
+  ePaperDirty dirty;
+  dirty.mark(8, 20, 30, 40);
+  EPD_Pattern planes[2] = { solidPattern(0xff), solidPattern(0x00) };
+  partialUpdateWindows<EPD>(dirty, patternRowSource, planes);
+  checkCounts(panel, "partial");
+
+  clearCounts(panel);
+  EPDTemp::read();
+  checkCounts(panel, "TSC read");
+  CHECK_EQ(panel.errors, 0);
+}
+
+//The full frame of the white/black/yellow demos, sent the way the sketch
+//used to (writeData() per byte) and as two bursts
+static void benchFrame(void)
+{
+  EmuController &panel = hostPanel();
+
+  clearCounts(panel);
+  uint64_t start = emu.now_ns;
+  for (uint8_t plane = 0; plane < 2; plane++)
+  {
+    EPD::writeCMD(plane ? 0x13 : 0x10);
+    for (uint16_t i = 0; i < EPD_PLANE_BYTES; i++)
+    {
+      EPD::writeData(0x00);
+    }
+  }
+  uint32_t byte_cs = EPD::cs_assertions;
+  uint64_t byte_ns = emu.now_ns - start;
+  checkCounts(panel, "per byte");
+
+  clearCounts(panel);
+  start = emu.now_ns;
+  writePatterns<EPD>(solidPattern(0x00), solidPattern(0x00));
+  uint32_t burst_cs = EPD::cs_assertions;
+  uint64_t burst_ns = emu.now_ns - start;
+  checkCounts(panel, "burst");
+
+  printf("full frame, %u bytes: per byte %u cs %.2f ms, burst %u cs %.2f ms\n",
+         EPD::bytes, byte_cs, byte_ns / 1e6, burst_cs, burst_ns / 1e6);
+  CHECK_EQ(byte_cs, 2 + 2 * EPD_PLANE_BYTES);
+  CHECK_EQ(burst_cs, 2);
+}
+
+int main(void)
+{
+  testPrimitives();
+  testFrames();
+  benchFrame();
+  return checkResult("test_bus");
+}
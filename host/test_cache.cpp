@@ -0,0 +1,151 @@
+//=============================================================================
+// Host test: a cache hit reads only the .EPD, a BMP saved again is converted
+// again, and a cache the card could not take in full is never left behind
+//=============================================================================
+#include "driver.h"
+#include "check.h"
+#include "bmp_writer.h"
+
+struct Picture
+{
+  uint32_t operator()(uint16_t x, uint16_t y) const
+  {
+    if ((y / 20) == 4)
+    {
+      return 0xffff00;
+    }
+    return ((x / 8 + y / 8) & 1) ? 0x000000 : 0xffffff;
+  }
+};
+
+static uint8_t expected[2][EMU_VRES][EMU_ROW_BYTES];
+
+//Load IMG.BMP through its cache, true if the controller then holds the
+//image loadBMP() gives
+static bool loadsRight(EmuController &panel)
+{
+  File bmp = SD.open("IMG.BMP");
+  CHECK(loadCachedBMP<EPD>(bmp));
+  bmp.close();
+  return 0 == memcmp(panel.ram, expected, sizeof(expected));
+}
+
+//What loadBMP() alone puts in the controller
+static void expect(EmuController &panel)
+{
+  File bmp = SD.open("IMG.BMP");
+  memset(panel.ram, 0x55, sizeof(panel.ram));
+  CHECK(loadBMP<EPD>(bmp));
+  bmp.close();
+  memcpy(expected, panel.ram, sizeof(expected));
+}
+
+static void testCRC(void)
+{
+  //the CRC-16/CCITT check value, as tools/epd_upload.py computes it
+  CHECK_EQ(crc16(0xffff, (const uint8_t *)"123456789", 9), 0x29b1);
+}
+
+static void testFresh(EmuController &panel)
+{
+  SD.files.clear();
+  SD.files["IMG.BMP"] = makeBMP(EPD_HRES, EPD_VRES, 24, false, Picture());
+  SD.touch("IMG.BMP");
+  uint32_t bmp_size = SD.files["IMG.BMP"].size();
+  expect(panel);
+
+  CHECK(loadsRight(panel));
+  CHECK(SD.exists("IMG.EPD"));
+  CHECK(0 == memcmp(SD.files["IMG.EPD"].data(), "EPD3", 4));
+
+  //the second time the BMP is not read at all
+  uint32_t cache_size = SD.files["IMG.EPD"].size();
+  CHECK(cache_size * 10 < bmp_size);
+  SD.bytes_read = 0;
+  SD.bytes_written = 0;
+  memset(panel.ram, 0x55, sizeof(panel.ram));
+  CHECK(loadsRight(panel));
+  CHECK_EQ(SD.bytes_written, 0);
+  CHECK(SD.bytes_read <= cache_size);
+
+  //the BMP is saved again, a pixel in the middle changed and the size the
+  //same: its modify time moves on and the cache is rebuilt
+  SD_Data &bmp = SD.files["IMG.BMP"];
+  uint32_t middle = bmp.size() / 2;
+  for (uint8_t i = 0; i < 3; i++)
+  {
+    bmp[middle + i] ^= 0x80;
+  }
+  SD.touch("IMG.BMP");
+  expect(panel);
+  SD.bytes_written = 0;
+  CHECK(loadsRight(panel));
+  CHECK(0 < SD.bytes_written);
+  CHECK(0 == memcmp(SD.files["IMG.EPD"].data(), "EPD3", 4));
+
+  //a different dither also makes it stale
+  ditherBegin(DITHER_BAYER);
+  expect(panel);
+  SD.bytes_written = 0;
+  CHECK(loadsRight(panel));
+  CHECK(0 < SD.bytes_written);
+  ditherBegin(DITHER_NONE);
+}
+
+//Every point at which the card can fill up: the image still loads, and the
+//.EPD is either complete or gone
+static void testFullCard(EmuController &panel)
+{
+  SD.files.clear();
+  SD.files["IMG.BMP"] = makeBMP(EPD_HRES, EPD_VRES, 24, true, Picture());
+  SD.touch("IMG.BMP");
+  expect(panel);
+  long full = sizeof(EPD_CacheHeader) + 4L * EPD_PLANE_BYTES + 4;
+  uint16_t kept = 0;
+  for (long budget = 0; budget <= full; budget += 97)
+  {
+    SD.remove("IMG.EPD");
+    SD.write_budget = budget;
+    memset(panel.ram, 0x55, sizeof(panel.ram));
+    CHECK(loadsRight(panel));
+    SD.write_budget = -1;
+    if (SD.exists("IMG.EPD"))
+    {
+      kept++;
+      CHECK(full <= budget);
+      //a cache that was kept is used, and right
+      SD.bytes_written = 0;
+      CHECK(loadsRight(panel));
+      CHECK_EQ(SD.bytes_written, 0);
+    }
+  }
+  CHECK(kept <= 1);
+
+  //loadBMP() gives up on planes it cannot write and says so by closing them
+  File planes = SD.open("PLANES.EPD", EPD_CACHE_WRITE);
+  uint8_t zeros[2 * EPD_PLANE_BYTES] = { 0 };
+  CHECK_EQ(planes.write(zeros, sizeof(zeros)), sizeof(zeros));
+  SD.write_budget = EPD_PLANE_BYTES;
+  File bmp = SD.open("IMG.BMP");
+  CHECK(loadBMP<EPD>(bmp, ROTATE_0, &planes, 0));
+  bmp.close();
+  SD.write_budget = -1;
+  CHECK(!planes);
+  CHECK(0 == memcmp(panel.ram, expected, sizeof(expected)));
+
+  //with room to spare it is kept
+  SD.remove("IMG.EPD");
+  CHECK(loadsRight(panel));
+  CHECK(SD.exists("IMG.EPD"));
+}
+
+int main(void)
+{
+  EmuController &panel = hostPanel();
+  CHECK(cacheBegin(8000000UL, 8));
+  testCRC();
+  testFresh(panel);
+  testFullCard(panel);
+  CHECK_EQ(panel.errors, 0);
+  return checkResult("test_cache");
+}
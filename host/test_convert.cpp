@@ -0,0 +1,225 @@
+//=============================================================================
+// Host test: the fixed point conversion against the original floating point
+// thresholds, and what it costs per pixel.
+//
+// The original sketch tested (red * .21) + (green * .72) + (blue * .07)
+// against 127 for the BW plane, and red > 228, green > 208, blue < 250 for
+// yellow. Every one of the 2^24 colours is checked. The fixed point weights
+// are off by at most 0.00125 per channel step, so the two may only disagree
+// where the floating point luminance is within 255 * 0.00125 of 127.
+//=============================================================================
+#include <math.h>
+#include <chrono>
+#include "driver.h"
+#include "check.h"
+
+//255 * |184 / 256 - .72|, the most the two luminances can differ by
+#define BOUNDARY (0.32)
+
+static double floatLuminance(uint8_t red, uint8_t green, uint8_t blue)
+{
+  return (red * .21) + (green * .72) + (blue * .07);
+}
+
+static bool floatDark(uint8_t red, uint8_t green, uint8_t blue)
+{
+  return !(127 < floatLuminance(red, green, blue));
+}
+
+static bool floatYellow(uint8_t red, uint8_t green, uint8_t blue)
+{
+  return (228 < red) && (208 < green) && (blue < 250);
+}
+
+static void testEveryColour(void)
+{
+  uint32_t mismatches = 0;
+  uint32_t outside = 0;
+  uint32_t yellow_mismatches = 0;
+  double worst = 0;
+  for (uint32_t rgb = 0; rgb < 0x1000000UL; rgb++)
+  {
+    uint8_t red = rgb >> 16;
+    uint8_t green = rgb >> 8;
+    uint8_t blue = rgb;
+    if ((isDark(red, green, blue) != 0) != floatDark(red, green, blue))
+    {
+      mismatches++;
+      double distance = fabs(floatLuminance(red, green, blue) - 127);
+      if (worst < distance)
+      {
+        worst = distance;
+      }
+      if (BOUNDARY < distance)
+      {
+        outside++;
+      }
+    }
+    if ((isYellow(red, green, blue) != 0) != floatYellow(red, green, blue))
+    {
+      yellow_mismatches++;
+    }
+  }
+  CHECK_EQ(outside, 0);
+  CHECK_EQ(yellow_mismatches, 0);
+  printf("  BW: %u of 16777216 colours differ (%.4f%%), all within %.3f of 127\n",
+         mismatches, mismatches * 100.0 / 0x1000000UL, worst);
+}
+
+//Per-pixel reference packing of the floating point tests, and optionally
+//the pixels the two may disagree on
+static void referenceRow(const uint8_t *bgr, uint16_t pixels, uint8_t *bw, uint8_t *yellow,
+                         uint8_t *ambiguous)
+{
+  uint16_t bytes = (pixels + 7) / 8;
+  memset(bw, 0, bytes);
+  memset(yellow, 0, bytes);
+  if (ambiguous)
+  {
+    memset(ambiguous, 0, bytes);
+  }
+  for (uint16_t x = 0; x < pixels; x++)
+  {
+    uint8_t blue = bgr[x * 3];
+    uint8_t green = bgr[x * 3 + 1];
+    uint8_t red = bgr[x * 3 + 2];
+    uint8_t bit = 0x80 >> (x & 7);
+    if (floatDark(red, green, blue))
+    {
+      bw[x >> 3] |= bit;
+    }
+    if (floatYellow(red, green, blue))
+    {
+      yellow[x >> 3] |= bit;
+    }
+    if (ambiguous && (fabs(floatLuminance(red, green, blue) - 127) <= BOUNDARY))
+    {
+      ambiguous[x >> 3] |= bit;
+    }
+  }
+}
+
+//Random rows, including short ones with a padded last byte, some pixels
+//drawn near the threshold and near the yellow corners
+static void testRows(void)
+{
+  static uint8_t bgr[EPD_VRES * 3];
+  uint8_t bw[EPD_VRES / 8 + 1];
+  uint8_t yellow[EPD_VRES / 8 + 1];
+  uint8_t ref_bw[EPD_VRES / 8 + 1];
+  uint8_t ref_yellow[EPD_VRES / 8 + 1];
+  uint8_t ambiguous[EPD_VRES / 8 + 1];
+  srand(4);
+  ditherBegin(DITHER_NONE);
+  for (uint16_t row = 0; row < 2000; row++)
+  {
+    uint16_t pixels = 1 + rand() % EPD_VRES;
+    for (uint16_t i = 0; i < pixels * 3; i += 3)
+    {
+      switch (rand() % 3)
+      {
+        case 0:
+          bgr[i] = rand();
+          bgr[i + 1] = rand();
+          bgr[i + 2] = rand();
+          break;
+        case 1:
+          //a grey near 127
+          bgr[i] = bgr[i + 1] = bgr[i + 2] = 120 + rand() % 15;
+          break;
+        default:
+          bgr[i] = 240 + rand() % 16;
+          bgr[i + 1] = 200 + rand() % 56;
+          bgr[i + 2] = 220 + rand() % 36;
+          break;
+      }
+    }
+    convertPixels_BGR(bgr, pixels, bw, yellow, 0);
+    referenceRow(bgr, pixels, ref_bw, ref_yellow, ambiguous);
+    for (uint16_t b = 0; b < (pixels + 7) / 8; b++)
+    {
+      CHECK_EQ(bw[b] & ~ambiguous[b], ref_bw[b] & ~ambiguous[b]);
+      CHECK_EQ(yellow[b], ref_yellow[b]);
+    }
+  }
+}
+
+//A palette classified once gives the same planes as the colours themselves
+static void testIndexed(void)
+{
+  uint8_t classes[64];
+  uint32_t palette[256];
+  srand(8);
+  for (uint16_t i = 0; i < 256; i++)
+  {
+    palette[i] = ((uint32_t)rand() << 8) ^ rand();
+    if (i & 1)
+    {
+      palette[i] |= 0xf0e000;
+    }
+    setPaletteClass(classes, i, palette[i] >> 16, palette[i] >> 8, palette[i]);
+  }
+  uint8_t row[EPD_VRES];
+  uint8_t bw[EPD_VRES / 8 + 1];
+  uint8_t yellow[EPD_VRES / 8 + 1];
+  for (uint8_t bpp = 1; bpp <= 8; bpp += 7)
+  {
+    for (uint16_t i = 0; i < sizeof(row); i++)
+    {
+      row[i] = rand();
+    }
+    uint16_t pixels = EPD_VRES - 3;
+    convertPixels_Indexed(row, pixels, bpp, classes, bw, yellow);
+    for (uint16_t x = 0; x < pixels; x++)
+    {
+      uint8_t index = (bpp == 8) ? row[x] : ((row[x >> 3] >> (7 - (x & 7))) & 1);
+      uint32_t rgb = palette[index];
+      uint8_t bit = 0x80 >> (x & 7);
+      CHECK_EQ((bw[x >> 3] & bit) != 0, isDark(rgb >> 16, rgb >> 8, rgb) != 0);
+      CHECK_EQ((yellow[x >> 3] & bit) != 0, floatYellow(rgb >> 16, rgb >> 8, rgb));
+    }
+  }
+}
+
+//Host ns per pixel of the conversion, next to the floating point one. Only
+//the ratio says anything about the AVR, which has no FPU.
+static void benchmark(void)
+{
+  static uint8_t bgr[EPD_VRES * 3];
+  uint8_t bw[EPD_VRES / 8];
+  uint8_t yellow[EPD_VRES / 8];
+  for (uint16_t i = 0; i < sizeof(bgr); i++)
+  {
+    bgr[i] = i * 37;
+  }
+  const uint32_t rows = 20000;
+  ditherBegin(DITHER_NONE);
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  uint8_t sink = 0;
+  for (uint32_t r = 0; r < rows; r++)
+  {
+    bgr[0] = r;
+    convertPixels_BGR(bgr, EPD_VRES, bw, yellow, 0);
+    sink ^= bw[r % sizeof(bw)] ^ yellow[0];
+  }
+  double fixed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  start = std::chrono::steady_clock::now();
+  for (uint32_t r = 0; r < rows; r++)
+  {
+    bgr[0] = r;
+    referenceRow(bgr, EPD_VRES, bw, yellow, NULL);
+    sink ^= bw[r % sizeof(bw)] ^ yellow[0];
+  }
+  double float_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  printf("  host: fixed point %.2f ns/pixel, floating point reference %.2f ns/pixel (%02x)\n",
+         fixed_ns / rows / EPD_VRES, float_ns / rows / EPD_VRES, sink);
+}
+
+int main(void)
+{
+  testEveryColour();
+  testRows();
+  testIndexed();
+  benchmark();
+  return checkResult("test_convert");
+}
@@ -0,0 +1,148 @@
+//=============================================================================
+// Host test: dithered conversion gives the same planes whether a row is
+// converted whole or in pieces, keeps greys out of yellow, and what each
+// mode costs per pixel
+//=============================================================================
+#define EPD_DITHER_DIFFUSION (1)
+#include <chrono>
+#include "driver.h"
+#include "check.h"
+
+#define ROWS      (48)
+#define ROW_BYTES ((DITHER_MAX_WIDTH + 7) / 8)
+
+static const uint8_t modes[] = { DITHER_BAYER, DITHER_FLOYD, DITHER_ATKINSON };
+static const char *const mode_names[] = { "bayer", "floyd", "atkinson" };
+
+static uint8_t image[ROWS][DITHER_MAX_WIDTH * 3];
+
+//A grey ramp, a yellow ramp and noise, width pixels a row
+static void makeImage(uint16_t width)
+{
+  srand(15);
+  for (uint16_t y = 0; y < ROWS; y++)
+  {
+    for (uint16_t x = 0; x < width; x++)
+    {
+      uint8_t *p = &image[y][x * 3];
+      uint8_t v = 255 * x / (width - 1);
+      switch (y / 16)
+      {
+        case 0:
+          p[0] = p[1] = p[2] = v;
+          break;
+        case 1:
+          p[0] = 0;
+          p[1] = v;
+          p[2] = v;
+          break;
+        default:
+          p[0] = rand();
+          p[1] = rand();
+          p[2] = rand();
+          break;
+      }
+    }
+  }
+}
+
+//Both planes of every row, each row converted in pieces of piece pixels
+//(a multiple of 8), or whole if piece is 0
+static void convert(uint8_t mode, uint16_t width, uint16_t piece,
+                    uint8_t bw[ROWS][ROW_BYTES], uint8_t yellow[ROWS][ROW_BYTES])
+{
+  ditherBegin(mode);
+  for (uint16_t y = 0; y < ROWS; y++)
+  {
+    uint16_t step = piece ? piece : width;
+    for (uint16_t x0 = 0; x0 < width; x0 += step)
+    {
+      uint16_t n = (width - x0 < step) ? (width - x0) : step;
+      convertPixels_BGR(&image[y][x0 * 3], n, &bw[y][x0 >> 3], &yellow[y][x0 >> 3], x0);
+    }
+  }
+}
+
+static void testPieces(void)
+{
+  static uint8_t whole_bw[ROWS][ROW_BYTES];
+  static uint8_t whole_yellow[ROWS][ROW_BYTES];
+  static uint8_t bw[ROWS][ROW_BYTES];
+  static uint8_t yellow[ROWS][ROW_BYTES];
+  static const uint16_t widths[] = { EPD_HRES, EPD_VRES };
+  static const uint16_t pieces[] = { 8, 16, 24, 40, 64, 96, 200 };
+  for (uint8_t w = 0; w < 2; w++)
+  {
+    uint16_t width = widths[w];
+    uint8_t bytes = (width + 7) / 8;
+    makeImage(width);
+    for (uint8_t m = 0; m < sizeof(modes); m++)
+    {
+      memset(whole_bw, 0, sizeof(whole_bw));
+      memset(whole_yellow, 0, sizeof(whole_yellow));
+      convert(modes[m], width, 0, whole_bw, whole_yellow);
+      for (uint8_t p = 0; p < sizeof(pieces) / sizeof(pieces[0]); p++)
+      {
+        memset(bw, 0, sizeof(bw));
+        memset(yellow, 0, sizeof(yellow));
+        convert(modes[m], width, pieces[p], bw, yellow);
+        uint32_t wrong = 0;
+        for (uint16_t y = 0; y < ROWS; y++)
+        {
+          wrong += memcmp(whole_bw[y], bw[y], bytes) != 0;
+          wrong += memcmp(whole_yellow[y], yellow[y], bytes) != 0;
+        }
+        if (wrong)
+        {
+          printf("  %s, %u wide in %u pixel pieces: %u rows differ\n",
+                 mode_names[m], width, pieces[p], wrong);
+        }
+        CHECK_EQ(wrong, 0);
+      }
+
+      //the grey ramp never picks up yellow, and darkens left to right
+      uint16_t dark_left = 0;
+      uint16_t dark_right = 0;
+      for (uint16_t y = 0; y < 16; y++)
+      {
+        for (uint8_t b = 0; b < bytes; b++)
+        {
+          CHECK_EQ(whole_yellow[y][b], 0);
+        }
+        for (uint16_t x = 0; x < width / 4; x++)
+        {
+          dark_left += (whole_bw[y][x >> 3] >> (7 - (x & 7))) & 1;
+          uint16_t r = width - 1 - x;
+          dark_right += (whole_bw[y][r >> 3] >> (7 - (r & 7))) & 1;
+        }
+      }
+      CHECK(dark_right * 4 < dark_left);
+    }
+  }
+}
+
+//Host ns per pixel of each mode, a landscape row at a time
+static void benchmark(void)
+{
+  static uint8_t bw[ROWS][ROW_BYTES];
+  static uint8_t yellow[ROWS][ROW_BYTES];
+  makeImage(DITHER_MAX_WIDTH);
+  const uint16_t repeats = 2000;
+  for (uint8_t m = 0; m < sizeof(modes); m++)
+  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint16_t r = 0; r < repeats; r++)
+    {
+      convert(modes[m], DITHER_MAX_WIDTH, 0, bw, yellow);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("  host: %-8s %.2f ns/pixel\n", mode_names[m], ns / repeats / ROWS / DITHER_MAX_WIDTH);
+  }
+}
+
+int main(void)
+{
+  testPieces();
+  benchmark();
+  return checkResult("test_dither");
+}
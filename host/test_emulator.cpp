@@ -0,0 +1,194 @@
+//=============================================================================
+// Host test: the controller emulator decodes what the driver sends
+//=============================================================================
+#include "driver.h"
+#include "check.h"
+
+static void testInit(void)
+{
+  EmuController &panel = hostPanel();
+  CHECK_EQ(panel.errors, 0);
+  CHECK(panel.powered);
+  CHECK_EQ(panel.panel_setting, 0x83);
+  CHECK_EQ(panel.power_setting[2], 0x2b);
+  CHECK_EQ(panel.booster[0], 0x17);
+  CHECK_EQ(panel.resolution[0], EPD_HRES);
+  CHECK_EQ((panel.resolution[1] << 8) | panel.resolution[2], EPD_VRES);
+  CHECK_EQ(panel.vcom, 0x28);
+  CHECK_EQ(panel.cdi, 0x87);
+  //reset and Power On were waited for
+  CHECK(panel.busyLevel(emu.now_ns));
+  CHECK(emu.timing.power_on < emu.now_ns);
+  //supplies, Power On, then Panel Setting, the temperature for PLL and the
+  //rest
+  static const uint8_t order[] = { 0x01, 0x06, 0x04, 0x00, 0x40, 0x30, 0x61, 0x82, 0x50 };
+  CHECK(panel.command_log == std::vector<uint8_t>(order, order + sizeof(order)));
+}
+
+//Waking from deep sleep sets the controller up in init()'s order, with the
+//profile it had; from Power Off it only powers on
+static void testWake(void)
+{
+  EmuController &panel = hostPanel();
+  EPDLUT::select(LUT_FAST_BW);
+  EPDPower::deepSleep();
+  panel.command_log.clear();
+  EPDPower::wake();
+  static const uint8_t order[] =
+  {
+    0x01, 0x06, 0x04, 0x00, 0x20, 0x21, 0x22, 0x23, 0x24, 0x30, 0x61, 0x82, 0x50
+  };
+  CHECK(panel.command_log == std::vector<uint8_t>(order, order + sizeof(order)));
+  CHECK(panel.powered);
+
+  EPDPower::powerOff();
+  CHECK(!panel.powered);
+  panel.command_log.clear();
+  EPDPower::wake();
+  CHECK(panel.command_log == std::vector<uint8_t>(1, 0x04));
+  CHECK(panel.powered);
+  CHECK_EQ(panel.errors, 0);
+}
+
+static void testRefresh(void)
+{
+  EmuController &panel = hostPanel();
+  writePatterns<EPD>(solidPattern(0xff), solidPattern(0x00));
+  uint64_t start = emu.now_ns;
+  EPDPanel::refresh();
+  EPDAsync::waitIdle();
+  CHECK_EQ(panel.errors, 0);
+  CHECK_EQ(panel.stats.refreshes, 1);
+  CHECK_EQ(panel.pixel(0, 0), EPD_BLACK);
+  CHECK_EQ(panel.pixel(EPD_HRES - 1, EPD_VRES - 1), EPD_BLACK);
+  //the OTP waveform at the PLL rate for 22 C
+  uint64_t expected = (uint64_t)EMU_OTP_TRICOLOR_FRAMES * 1000000000ULL / panel.frameRate();
+  CHECK(expected <= emu.now_ns - start);
+  CHECK(emu.now_ns - start < expected + 1000000ULL);
+}
+
+static void testPartialWindow(void)
+{
+  EmuController &panel = hostPanel();
+  writePatterns<EPD>(solidPattern(0x00), solidPattern(0x00));
+  EPDPanel::refresh();
+  EPDAsync::waitIdle();
+  uint8_t bw[2 * 4];
+  uint8_t yellow[2 * 4];
+  memset(bw, 0xff, sizeof(bw));
+  memset(yellow, 0x00, sizeof(yellow));
+  EPD::writeCMD(0x91);
+  EPD_Window w = { 2, 3, 100, 103 };
+  setPartialWindow<EPD>(w);
+  EPD::writeCMDData(0x10, bw, sizeof(bw));
+  EPD::writeCMDData(0x13, yellow, sizeof(yellow));
+  EPD::writeCMD(0x12);
+  EPD::waitReady();
+  EPD::writeCMD(0x92);
+  CHECK_EQ(panel.errors, 0);
+  CHECK_EQ(panel.stats.partial_refreshes, 1);
+  CHECK_EQ(panel.pixel(16, 100), EPD_BLACK);
+  CHECK_EQ(panel.pixel(31, 103), EPD_BLACK);
+  CHECK_EQ(panel.pixel(15, 100), EPD_WHITE);
+  CHECK_EQ(panel.pixel(32, 100), EPD_WHITE);
+  CHECK_EQ(panel.pixel(16, 104), EPD_WHITE);
+
+  //a byte past the window is reported
+  EPD::writeCMD(0x91);
+  setPartialWindow<EPD>(w);
+  uint8_t extra[9];
+  memset(extra, 0, sizeof(extra));
+  EPD::writeCMDData(0x10, extra, sizeof(extra));
+  EPD::writeCMD(0x92);
+  CHECK_EQ(panel.errors, 1);
+}
+
+static void testTemperatureAndLUTs(void)
+{
+  EmuController &panel = hostPanel();
+  panel.temperature = -3;
+  CHECK_EQ(EPDTemp::read(), -3);
+  panel.temperature = 41;
+  CHECK_EQ(EPDTemp::read(), 41);
+
+  EPDLUT::select(LUT_FAST_BW);
+  CHECK_EQ(panel.panel_setting, 0xb3);
+  CHECK_EQ(panel.lut_bytes[0], 44);
+  CHECK_EQ(panel.lut_bytes[4], 42);
+  //VCOM_LUT_LUTC: 8 x 2 + 80 + 20 + 36 frames
+  CHECK_EQ(panel.refreshFrames(), 152);
+  EPDLUT::select(LUT_TRICOLOR);
+  CHECK_EQ(panel.refreshFrames(), EMU_OTP_TRICOLOR_FRAMES);
+  CHECK_EQ(panel.errors, 0);
+}
+
+//The band for the selected profile and temperature sets profile and PLL
+static void testBands(void)
+{
+  EmuController &panel = hostPanel();
+  //warm: tri-color at its 100 Hz, register B/W at 150 Hz
+  panel.temperature = 25;
+  EPDTemp::expire();
+  EPDLUT::select(LUT_TRICOLOR);
+  EPDTemp::apply();
+  CHECK_EQ(panel.panel_setting, 0x83);
+  CHECK_EQ(panel.pll, 0x3a);
+  EPDLUT::select(LUT_FAST_BW);
+  EPDTemp::apply();
+  CHECK_EQ(panel.panel_setting, 0xb3);
+  CHECK_EQ(panel.pll, 0x29);
+
+  //cold: the register waveform gives way to OTP B/W at 50 Hz, and stays
+  //given way when it is selected again
+  panel.temperature = -3;
+  EPDTemp::expire();
+  EPDTemp::apply();
+  CHECK_EQ(EPDLUT::current(), LUT_OTP_BW);
+  CHECK_EQ(panel.panel_setting, 0x93);
+  CHECK_EQ(panel.pll, 0x3c);
+  EPDLUT::select(LUT_FAST_BW);
+  CHECK_EQ(EPDLUT::current(), LUT_OTP_BW);
+  EPDLUT::select(LUT_TRICOLOR);
+  EPDTemp::apply();
+  CHECK_EQ(panel.panel_setting, 0x83);
+  CHECK_EQ(panel.pll, 0x3c);
+
+  panel.temperature = 22;
+  EPDTemp::expire();
+  EPDTemp::apply();
+  CHECK_EQ(panel.pll, 0x3a);
+  CHECK_EQ(panel.errors, 0);
+}
+
+static void testFaults(void)
+{
+  EmuController &panel = hostPanel();
+  //a refresh with the supplies off
+  EPD::writeCMD(0x02);
+  EPD::waitReady();
+  EPD::writeCMD(0x12);
+  CHECK_EQ(panel.errors, 1);
+  EPD::waitReady();
+  //deep sleep ignores everything until RESET
+  EPD::writeCMDFill(0x07, 0xa5, 1);
+  CHECK(panel.asleep);
+  EPD::writeCMD(0x04);
+  CHECK_EQ(panel.errors, 2);
+  EPDPanel::reset();
+  CHECK(!panel.asleep);
+  //nothing selected
+  SPI.transfer(0x00);
+  CHECK_EQ(emu.bus_conflicts, 1);
+}
+
+int main(void)
+{
+  testInit();
+  testWake();
+  testRefresh();
+  testPartialWindow();
+  testTemperatureAndLUTs();
+  testBands();
+  testFaults();
+  return checkResult("test_emulator");
+}
@@ -0,0 +1,334 @@
+//=============================================================================
+// Host test: every orientation of packed flash images, BMPs (1, 8 and 24
+// bits per pixel, bottom-up and top-down) and the canvas puts each source
+// pixel where orientPoint() says, against a reference built a pixel at a
+// time. orientPoint() itself is pinned down by where the corners go.
+//=============================================================================
+#include <vector>
+#include "driver.h"
+#include "check.h"
+#include "bmp_writer.h"
+
+#define SOURCE_MAX (EPD_VRES)
+
+//Ink of each source pixel, EPD_WHITE, EPD_BLACK or EPD_YELLOW
+static uint8_t source[SOURCE_MAX][SOURCE_MAX];
+//Ink of each panel pixel
+static uint8_t expected[EPD_VRES][EPD_HRES];
+
+static const char *const names[8] =
+{
+  "ROTATE_0", "MIRROR_X", "MIRROR_Y", "ROTATE_180",
+  "SWAP_XY", "ROTATE_90", "ROTATE_270", "SWAP_XY|MIRROR_X|MIRROR_Y"
+};
+
+//An image with no symmetry, colors inks, 2 or 3
+static void makeSource(uint8_t orientation, uint8_t colors)
+{
+  for (uint16_t y = 0; y < orientHeight(orientation); y++)
+  {
+    for (uint16_t x = 0; x < orientWidth(orientation); x++)
+    {
+      uint16_t h = (x * 7 + y * 13) ^ (x * y) ^ (x >> 3);
+      source[y][x] = h % colors;
+    }
+  }
+}
+
+//Forward map every source pixel onto the panel
+static void expectSource(uint8_t orientation)
+{
+  memset(expected, 0xff, sizeof(expected));
+  for (int16_t y = 0; y < orientHeight(orientation); y++)
+  {
+    for (int16_t x = 0; x < orientWidth(orientation); x++)
+    {
+      int16_t px = x;
+      int16_t py = y;
+      orientPoint(orientation, px, py);
+      expected[py][px] = source[y][x];
+    }
+  }
+}
+
+//Panel pixels that are not what expected says, from controller RAM
+static uint32_t wrongPixels(const EmuController &panel)
+{
+  uint32_t wrong = 0;
+  for (uint16_t y = 0; y < EPD_VRES; y++)
+  {
+    for (uint16_t x = 0; x < EPD_HRES; x++)
+    {
+      uint8_t mask = 0x80 >> (x & 7);
+      uint8_t ink = (panel.ram[1][y][x >> 3] & mask) ? EPD_YELLOW :
+                    ((panel.ram[0][y][x >> 3] & mask) ? EPD_BLACK : EPD_WHITE);
+      wrong += (ink != expected[y][x]);
+    }
+  }
+  return wrong;
+}
+
+static void report(const char *what, uint8_t orientation, uint32_t wrong)
+{
+  if (wrong)
+  {
+    printf("  %s %s: %u pixels wrong\n", what, names[orientation], wrong);
+  }
+  CHECK_EQ(wrong, 0);
+}
+
+static void testOrientPoint(void)
+{
+  //where the source's top left and top right corners land
+  static const int16_t corners[8][4] =
+  {
+    {   0,   0, 103,   0 },  //ROTATE_0
+    { 103,   0,   0,   0 },  //MIRROR_X
+    {   0, 211, 103, 211 },  //MIRROR_Y
+    { 103, 211,   0, 211 },  //ROTATE_180
+    {   0,   0,   0, 211 },  //SWAP_XY
+    { 103,   0, 103, 211 },  //ROTATE_90, clockwise
+    {   0, 211,   0,   0 },  //ROTATE_270
+    { 103, 211, 103,   0 },
+  };
+  for (uint8_t o = 0; o < 8; o++)
+  {
+    int16_t x0 = 0, y0 = 0;
+    int16_t x1 = orientWidth(o) - 1, y1 = 0;
+    orientPoint(o, x0, y0);
+    orientPoint(o, x1, y1);
+    CHECK_EQ(x0, corners[o][0]);
+    CHECK_EQ(y0, corners[o][1]);
+    CHECK_EQ(x1, corners[o][2]);
+    CHECK_EQ(y1, corners[o][3]);
+    //and back
+    unorientPoint(o, x1, y1);
+    CHECK_EQ(x1, orientWidth(o) - 1);
+    CHECK_EQ(y1, 0);
+  }
+}
+
+static void testTranspose8(void)
+{
+  uint8_t in[8 * 3];
+  uint8_t out[8];
+  srand(16);
+  for (uint16_t trial = 0; trial < 1000; trial++)
+  {
+    for (uint8_t i = 0; i < sizeof(in); i++)
+    {
+      in[i] = rand();
+    }
+    transpose8(in, 3, out);
+    for (uint8_t i = 0; i < 8; i++)
+    {
+      for (uint8_t j = 0; j < 8; j++)
+      {
+        CHECK_EQ((out[i] >> (7 - j)) & 1, (in[j * 3] >> (7 - i)) & 1);
+      }
+    }
+  }
+}
+
+//Source plane of one ink, rows padded to whole bytes
+static std::vector<uint8_t> sourcePlane(uint8_t orientation, uint8_t ink)
+{
+  uint8_t row_bytes = orientRowBytes(orientation);
+  std::vector<uint8_t> plane((size_t)row_bytes * orientHeight(orientation), 0);
+  for (uint16_t y = 0; y < orientHeight(orientation); y++)
+  {
+    for (uint16_t x = 0; x < orientWidth(orientation); x++)
+    {
+      if (source[y][x] == ink)
+      {
+        plane[y * row_bytes + (x >> 3)] |= 0x80 >> (x & 7);
+      }
+    }
+  }
+  return plane;
+}
+
+//Records as tools/pack_images.py writes them
+static std::vector<uint8_t> pack(const std::vector<uint8_t> &plane)
+{
+  std::vector<uint8_t> out;
+  size_t i = 0;
+  while (i < plane.size())
+  {
+    size_t run = 1;
+    while ((i + run < plane.size()) && (plane[i + run] == plane[i]) && (run < 129))
+    {
+      run++;
+    }
+    if (2 <= run)
+    {
+      out.push_back(0x80 + run - 2);
+      out.push_back(plane[i]);
+      i += run;
+      continue;
+    }
+    size_t start = i;
+    while ((i < plane.size()) && (i - start < 128) &&
+           !((i + 1 < plane.size()) && (plane[i + 1] == plane[i])))
+    {
+      i++;
+    }
+    if (i == start)
+    {
+      i++;
+    }
+    out.push_back(i - start - 1);
+    out.insert(out.end(), plane.begin() + start, plane.begin() + i);
+  }
+  return out;
+}
+
+static void testPacked(EmuController &panel)
+{
+  for (uint8_t o = 0; o < 8; o++)
+  {
+    makeSource(o, 3);
+    expectSource(o);
+    std::vector<uint8_t> bw = pack(sourcePlane(o, EPD_BLACK));
+    std::vector<uint8_t> yellow = pack(sourcePlane(o, EPD_YELLOW));
+    memset(panel.ram, 0x55, sizeof(panel.ram));
+    loadPackedOriented<EPD>(o, bw.data(), yellow.data());
+    report("packed", o, wrongPixels(panel));
+  }
+}
+
+struct SourceColor
+{
+  uint32_t operator()(uint16_t x, uint16_t y) const
+  {
+    static const uint32_t rgb[3] = { 0xffffff, 0x000000, 0xffff00 };
+    return rgb[source[y][x]];
+  }
+};
+
+static void testBMP(EmuController &panel)
+{
+  static const uint32_t palette[3] = { 0xffffff, 0x000000, 0xffff00 };
+  static const uint8_t depths[3] = { 1, 8, 24 };
+  ditherBegin(DITHER_NONE);
+  for (uint8_t o = 0; o < 8; o++)
+  {
+    for (uint8_t d = 0; d < 3; d++)
+    {
+      uint8_t bpp = depths[d];
+      makeSource(o, (bpp == 1) ? 2 : 3);
+      expectSource(o);
+      for (uint8_t top_down = 0; top_down < 2; top_down++)
+      {
+        SD.files["O.BMP"] = makeBMP(orientWidth(o), orientHeight(o), bpp, top_down,
+                                    SourceColor(), palette, (bpp == 1) ? 2 : 3);
+        File f = SD.open("O.BMP");
+        memset(panel.ram, 0x55, sizeof(panel.ram));
+        CHECK(loadBMP<EPD>(f, o));
+        f.close();
+        char what[32];
+        snprintf(what, sizeof(what), "%u bpp %s BMP", bpp, top_down ? "top-down" : "bottom-up");
+        report(what, o, wrongPixels(panel));
+      }
+    }
+  }
+}
+
+//A bitmap 13 x 9, rows padded to whole bytes
+static const uint8_t ARROW[9 * 2] PROGMEM =
+{
+  0xff, 0xf8, 0x80, 0x00, 0xbf, 0x00, 0xa0, 0x00, 0xa8, 0x00,
+  0xa4, 0x00, 0xa2, 0x00, 0x81, 0x00, 0x80, 0x80,
+};
+
+static void paint(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t ink)
+{
+  for (int16_t y = y0; y <= y1; y++)
+  {
+    for (int16_t x = x0; x <= x1; x++)
+    {
+      source[y][x] = ink;
+    }
+  }
+}
+
+static void testCanvas(EmuController &panel)
+{
+  static const char text[] = "Az9";
+  for (uint8_t o = 0; o < 8; o++)
+  {
+    ePaperCanvas<8> canvas;
+    canvas.setOrientation(o);
+    canvas.fillRect(40, 30, 5, 7, EPD_BLACK);
+    canvas.frameRect(50, 60, 90, 100, EPD_YELLOW);
+    canvas.line(10, 80, 70, 80, EPD_BLACK);
+    canvas.line(95, 5, 95, 70, EPD_YELLOW);
+    canvas.bitmap(20, 40, 13, 9, ARROW, EPD_YELLOW);
+    canvas.text(12, 85, text, Font_Small, EPD_BLACK);
+
+    //the same items drawn in source coordinates
+    memset(source, EPD_WHITE, sizeof(source));
+    paint(5, 7, 40, 30, EPD_BLACK);
+    paint(50, 60, 90, 60, EPD_YELLOW);
+    paint(50, 100, 90, 100, EPD_YELLOW);
+    paint(50, 60, 50, 100, EPD_YELLOW);
+    paint(90, 60, 90, 100, EPD_YELLOW);
+    paint(10, 80, 70, 80, EPD_BLACK);
+    paint(95, 5, 95, 70, EPD_YELLOW);
+    for (int16_t v = 0; v < 9; v++)
+    {
+      for (int16_t u = 0; u < 13; u++)
+      {
+        if (ARROW[v * 2 + (u >> 3)] & (0x80 >> (u & 7)))
+        {
+          source[40 + v][20 + u] = EPD_YELLOW;
+        }
+      }
+    }
+    uint16_t text_width = textWidth(Font_Small, text);
+    for (int16_t v = 0; v < Font_Small.height; v++)
+    {
+      for (int16_t u = 0; u < text_width; u++)
+      {
+        if (textPixel(Font_Small, text, u, v))
+        {
+          source[85 + v][12 + u] = EPD_BLACK;
+        }
+      }
+    }
+    expectSource(o);
+
+    memset(panel.ram, 0x55, sizeof(panel.ram));
+    renderBands<EPD>(canvas);
+    report("canvas", o, wrongPixels(panel));
+
+    //partial updates: a tall narrow window, sent in two bands, then the
+    //whole panel
+    for (uint16_t y = 0; y < EPD_VRES; y++)
+    {
+      memset(&panel.ram[0][y][2], 0x55, 2);
+      memset(&panel.ram[1][y][2], 0x55, 2);
+    }
+    canvas.dirty.mark(16, 0, 31, EPD_VRES - 1);
+    renderDirty<EPD>(canvas);
+    EPDAsync::waitIdle();
+    report("canvas strip", o, wrongPixels(panel));
+    memset(panel.ram, 0x55, sizeof(panel.ram));
+    canvas.dirty.mark(0, 0, EPD_HRES - 1, EPD_VRES - 1);
+    renderDirty<EPD>(canvas);
+    EPDAsync::waitIdle();
+    report("canvas partial", o, wrongPixels(panel));
+  }
+}
+
+int main(void)
+{
+  EmuController &panel = hostPanel();
+  testOrientPoint();
+  testTranspose8();
+  testPacked(panel);
+  testBMP(panel);
+  testCanvas(panel);
+  CHECK_EQ(panel.errors, 0);
+  return checkResult("test_orient");
+}
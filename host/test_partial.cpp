@@ -0,0 +1,196 @@
+//=============================================================================
+// Host test: dirty rectangles and text fields are ordered and clipped to
+// the panel, and partial updates only touch their windows
+//=============================================================================
+#include "driver.h"
+#include "check.h"
+
+static uint32_t source_overruns = 0;
+
+//Solid bytes per plane, context points at the two values
+static void solidSource(uint8_t plane, uint16_t y, uint8_t first_byte,
+                        uint8_t count, uint8_t *bytes, void *context)
+{
+  if ((EPD_ROW_BYTES < first_byte + count) || (EPD_VRES <= y))
+  {
+    source_overruns++;
+  }
+  memset(bytes, ((const uint8_t *)context)[plane], count);
+}
+
+static bool windowIs(const EPD_Window &w, uint8_t xb1, uint8_t xb2, uint16_t y1, uint16_t y2)
+{
+  return (w.xb1 == xb1) && (w.xb2 == xb2) && (w.y1 == y1) && (w.y2 == y2);
+}
+
+static void testMark(void)
+{
+  ePaperDirty dirty;
+  //corners either way round
+  dirty.mark(47, 181, 8, 150);
+  CHECK_EQ(dirty.count, 1);
+  CHECK(windowIs(dirty.window[0], 1, 5, 150, 181));
+
+  //clipped to the panel
+  dirty.clear();
+  dirty.mark(90, 200, 150, 500);
+  CHECK(windowIs(dirty.window[0], 11, 12, 200, 211));
+  dirty.clear();
+  dirty.mark(-20, -5, 3, 2);
+  CHECK(windowIs(dirty.window[0], 0, 0, 0, 2));
+  dirty.clear();
+  dirty.mark(200, 10, 104, 20);
+  dirty.mark(0, 212, 10, 300);
+  dirty.mark(-10, 0, -1, 10);
+  CHECK_EQ(dirty.count, 0);
+
+  //far apart stays apart, neighbours merge
+  dirty.clear();
+  dirty.mark(0, 0, 7, 7);
+  dirty.mark(96, 200, 103, 211);
+  CHECK_EQ(dirty.count, 2);
+  dirty.mark(8, 0, 15, 7);
+  CHECK_EQ(dirty.count, 2);
+}
+
+static void testUpdate(void)
+{
+  EmuController &panel = hostPanel();
+  writePatterns<EPD>(solidPattern(0x00), solidPattern(0x00));
+  EPDPanel::refresh();
+  EPDAsync::waitIdle();
+
+  //past the right and bottom edges
+  uint8_t colors[2] = { 0xff, 0x00 };
+  ePaperDirty dirty;
+  dirty.mark(150, 500, 96, 205);
+  partialUpdateWindows<EPD>(dirty, solidSource, colors);
+  CHECK_EQ(source_overruns, 0);
+  CHECK_EQ(panel.errors, 0);
+  CHECK_EQ(panel.stats.partial_refreshes, 1);
+  CHECK_EQ(panel.pixel(96, 205), EPD_BLACK);
+  CHECK_EQ(panel.pixel(103, 211), EPD_BLACK);
+  CHECK_EQ(panel.pixel(95, 211), EPD_WHITE);
+  CHECK_EQ(panel.pixel(103, 204), EPD_WHITE);
+
+  //the sketch's partial demo, corners reversed
+  colors[0] = 0x00;
+  colors[1] = 0xff;
+  dirty.mark(100, 100, 50, 24);
+  partialUpdateWindows<EPD>(dirty, solidSource, colors);
+  CHECK_EQ(panel.errors, 0);
+  CHECK_EQ(panel.pixel(48, 24), EPD_YELLOW);
+  CHECK_EQ(panel.pixel(103, 100), EPD_YELLOW);
+  CHECK_EQ(panel.pixel(47, 24), EPD_WHITE);
+  CHECK_EQ(panel.pixel(60, 101), EPD_WHITE);
+}
+
+//A partial update returns with its refresh running; the queue leaves
+//partial mode when it ends, and the next update waits for that
+static void testAsync(void)
+{
+  EmuController &panel = hostPanel();
+  EPDAsync::waitIdle();
+  uint8_t colors[2] = { 0xff, 0x00 };
+  ePaperDirty dirty;
+  dirty.mark(8, 8, 23, 23);
+  uint32_t refreshes = panel.stats.partial_refreshes;
+  partialUpdateWindows<EPD>(dirty, solidSource, colors);
+  CHECK(EPD::busy());
+  CHECK(panel.partial);
+  CHECK_EQ(panel.command_log.back(), 0x12);
+  CHECK(!EPDAsync::idle());
+  EPDAsync::waitIdle();
+  CHECK(!panel.partial);
+  CHECK_EQ(panel.command_log.back(), 0x92);
+  CHECK_EQ(panel.stats.partial_refreshes, refreshes + 1);
+
+  //back to back: the second waits, then enters partial mode again
+  dirty.mark(8, 8, 23, 23);
+  partialUpdateWindows<EPD>(dirty, solidSource, colors);
+  size_t first = panel.command_log.size();
+  colors[0] = 0x00;
+  dirty.mark(40, 40, 47, 47);
+  partialUpdateWindows<EPD>(dirty, solidSource, colors);
+  CHECK_EQ(panel.command_log[first], 0x92);
+  CHECK_EQ(panel.command_log[first + 1], 0x91);
+  EPDAsync::waitIdle();
+  CHECK_EQ(panel.errors, 0);
+  CHECK_EQ(panel.stats.partial_refreshes, refreshes + 3);
+  CHECK_EQ(panel.pixel(40, 40), EPD_WHITE);
+  CHECK_EQ(panel.pixel(8, 8), EPD_BLACK);
+}
+
+//A text field on panel, for checking what a field drew
+static uint32_t wrongTextPixels(const EmuController &panel, const ePaperTextField &field)
+{
+  EPD_Window w;
+  field.window(w);
+  uint32_t wrong = 0;
+  for (uint16_t y = w.y1; y <= w.y2; y++)
+  {
+    uint8_t row[EPD_ROW_BYTES];
+    memset(row, 0x00, EPD_ROW_BYTES);
+    textRow(*field.font, field.text, field.textX(), y - field.y, row);
+    for (uint16_t x = w.xb1 << 3; x < (uint16_t)((w.xb2 + 1) << 3); x++)
+    {
+      bool ink = row[x >> 3] & (0x80 >> (x & 7));
+      wrong += (panel.pixel(x, y) != (ink ? EPD_BLACK : EPD_WHITE));
+    }
+  }
+  return wrong;
+}
+
+//Text fields hanging off the panel are clipped to it
+static void testTextField(void)
+{
+  ePaperTextField field = { &Font_Large, -10, -4, 40, EPD_BLACK, TEXT_LEFT, "" };
+  EPD_Window w;
+  CHECK(field.window(w));
+  CHECK(windowIs(w, 0, 3, 0, 11));
+  field.x = 90;
+  field.y = 205;
+  CHECK(field.window(w));
+  CHECK(windowIs(w, 11, 12, 205, 211));
+  field.x = 104;
+  CHECK(!field.window(w));
+  field.x = -40;
+  field.y = 0;
+  CHECK(!field.window(w));
+  field.x = 0;
+  field.y = 212;
+  CHECK(!field.window(w));
+
+  EmuController &panel = hostPanel();
+  writePatterns<EPD>(solidPattern(0x00), solidPattern(0x00));
+  EPDPanel::refresh();
+  EPDAsync::waitIdle();
+  field.x = -10;
+  field.y = -4;
+  CHECK(0 < updateTextField<EPD>(field, "1234"));
+  field.x = 90;
+  field.y = 205;
+  CHECK(0 < updateTextField<EPD>(field, "5678"));
+  CHECK_EQ(panel.errors, 0);
+  CHECK_EQ(panel.stats.partial_refreshes, 2);
+  CHECK_EQ(wrongTextPixels(panel, field), 0);
+  field.x = -10;
+  field.y = -4;
+  field.text = "1234";
+  CHECK_EQ(wrongTextPixels(panel, field), 0);
+
+  //nothing is sent for a field wholly off the panel
+  uint32_t commands = panel.stats.commands;
+  field.y = -16;
+  CHECK_EQ(updateTextField<EPD>(field, "9"), 0);
+  CHECK_EQ(panel.stats.commands, commands);
+}
+
+int main(void)
+{
+  testMark();
+  testUpdate();
+  testAsync();
+  testTextField();
+  return checkResult("test_partial");
+}
@@ -0,0 +1,55 @@
+//=============================================================================
+// Host test: pattern rows against a pixel by pixel reference, for every
+// cell size including 0, which is taken as 1
+//=============================================================================
+#include "driver.h"
+#include "check.h"
+
+static bool referencePixel(uint8_t kind, uint8_t size, uint16_t x, uint16_t y)
+{
+  if (size == 0)
+  {
+    size = 1;
+  }
+  switch (kind)
+  {
+    case PATTERN_CHECKER:
+      return ((x / size) + (y / size)) & 1;
+    case PATTERN_HSTRIPES:
+      return (y / size) & 1;
+    default:
+      return (x / size) & 1;
+  }
+}
+
+int main(void)
+{
+  static const uint8_t kinds[] = { PATTERN_CHECKER, PATTERN_HSTRIPES, PATTERN_VSTRIPES };
+  uint8_t row[EPD_ROW_BYTES];
+  for (uint8_t k = 0; k < sizeof(kinds); k++)
+  {
+    for (uint16_t size = 0; size < 256; size++)
+    {
+      for (uint8_t inverted = 0; inverted < 2; inverted++)
+      {
+        EPD_Pattern p = makePattern(kinds[k], size, inverted);
+        CHECK(p.size != 0);
+        uint32_t wrong = 0;
+        for (uint16_t y = 0; y < EPD_VRES; y++)
+        {
+          patternRow(p, y, row);
+          for (uint16_t x = 0; x < EPD_HRES; x++)
+          {
+            bool on = (row[x >> 3] >> (7 - (x & 7))) & 1;
+            if (on != (referencePixel(kinds[k], size, x, y) != inverted))
+            {
+              wrong++;
+            }
+          }
+        }
+        CHECK_EQ(wrong, 0);
+      }
+    }
+  }
+  return checkResult("test_pattern");
+}
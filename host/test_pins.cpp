@@ -0,0 +1,171 @@
+//=============================================================================
+// Host test: the pin layer, through EPD_PIN_TRACE and the emulator's pin
+// transition recorder
+//=============================================================================
+#include <vector>
+#include <stdint.h>
+
+struct TraceEvent
+{
+  uint8_t pin;
+  uint8_t level;
+};
+static std::vector<TraceEvent> trace;
+
+static void tracePin(uint8_t pin, uint8_t level)
+{
+  TraceEvent e = { pin, level };
+  trace.push_back(e);
+}
+#define EPD_PIN_TRACE(pin, level) tracePin(pin, level)
+
+#include "driver.h"
+#include "check.h"
+
+typedef ePaperBus<9, 6, 7, 2> EPD2;
+
+static bool traceIs(const uint8_t *expected, size_t n)
+{
+  bool same = (trace.size() == n / 2);
+  for (size_t i = 0; same && (i < trace.size()); i++)
+  {
+    same = (trace[i].pin == expected[2 * i]) && (trace[i].level == expected[2 * i + 1]);
+  }
+  if (!same)
+  {
+    printf("trace:");
+    for (size_t i = 0; i < trace.size(); i++)
+    {
+      printf(" %u%c", trace[i].pin, trace[i].level ? '+' : '-');
+    }
+    printf("\n");
+  }
+  trace.clear();
+  return same;
+}
+
+static void testSequences(void)
+{
+  EmuController &panel = hostPanel();
+  trace.clear();
+
+  EPD::writeCMD(0x11);
+  const uint8_t command[] = { EPD_DC, LOW, EPD_CS, LOW, EPD_CS, HIGH };
+  CHECK(traceIs(command, sizeof(command)));
+
+  const uint8_t data[3] = { 1, 2, 3 };
+  EPD::writeCMDData(0x61, data, sizeof(data));
+  const uint8_t burst[] = { EPD_DC, LOW, EPD_CS, LOW, EPD_DC, HIGH, EPD_CS, HIGH };
+  CHECK(traceIs(burst, sizeof(burst)));
+
+  EPD::beginData();
+  EPD::endTransfer();
+  const uint8_t more[] = { EPD_DC, HIGH, EPD_CS, LOW, EPD_CS, HIGH };
+  CHECK(traceIs(more, sizeof(more)));
+
+  //a second wiring only touches its own pins
+  emu.addPanel(9, 6, 7, 2);
+  EPD2::begin();
+  trace.clear();
+  EPD2::writeCMD(0x11);
+  const uint8_t second[] = { 6, LOW, 9, LOW, 9, HIGH };
+  CHECK(traceIs(second, sizeof(second)));
+  CHECK_EQ(panel.errors, 0);
+}
+
+static void testRecorder(void)
+{
+  hostPanel();
+  emu.record_pins = true;
+  emu.pin_events.clear();
+  trace.clear();
+
+  writePatterns<EPD>(solidPattern(0x00), solidPattern(0xff));
+  //the recorder keeps real transitions, the trace every write
+  size_t changes = 0;
+  uint8_t level[EMU_PINS];
+  memset(level, 0xff, sizeof(level));
+  level[EPD_CS] = HIGH;
+  level[EPD_DC] = HIGH;
+  for (size_t i = 0; i < trace.size(); i++)
+  {
+    if (level[trace[i].pin] != trace[i].level)
+    {
+      level[trace[i].pin] = trace[i].level;
+      CHECK(changes < emu.pin_events.size());
+      if (changes < emu.pin_events.size())
+      {
+        CHECK_EQ(emu.pin_events[changes].pin, trace[i].pin);
+        CHECK_EQ(emu.pin_events[changes].level, trace[i].level);
+      }
+      changes++;
+    }
+  }
+  CHECK_EQ(changes, emu.pin_events.size());
+  //two planes: CS down and up twice
+  uint32_t cs_edges = 0;
+  for (size_t i = 0; i < emu.pin_events.size(); i++)
+  {
+    cs_edges += (emu.pin_events[i].pin == EPD_CS);
+  }
+  CHECK_EQ(cs_edges, 4);
+  emu.record_pins = false;
+}
+
+static void testReset(void)
+{
+  hostPanel();
+  emu.record_pins = true;
+  emu.pin_events.clear();
+  EPDPanel::reset();
+  CHECK_EQ(emu.pin_events.size(), 2);
+  if (emu.pin_events.size() == 2)
+  {
+    CHECK_EQ(emu.pin_events[0].pin, EPD_RESET);
+    CHECK_EQ(emu.pin_events[0].level, LOW);
+    CHECK_EQ(emu.pin_events[1].level, HIGH);
+    uint64_t pulse = emu.pin_events[1].ns - emu.pin_events[0].ns;
+    CHECK(EPD_RESET_PULSE_US * 1000ULL <= pulse);
+  }
+  //reset() returns once BUSY is high again
+  CHECK(emu.panel(EPD_CS)->busyLevel(emu.now_ns));
+  emu.record_pins = false;
+}
+
+static void testRead(void)
+{
+  EmuController &panel = hostPanel();
+  panel.temperature = 25;
+  emu.record_pins = true;
+  emu.pin_events.clear();
+  CHECK_EQ(EPDTemp::read(), 25);
+  //two bytes clocked by hand with CS low, MOSI handed back afterwards
+  uint32_t rising = 0;
+  bool selected = false;
+  for (size_t i = 0; i < emu.pin_events.size(); i++)
+  {
+    const EmuPinEvent &e = emu.pin_events[i];
+    if (e.pin == EPD_CS)
+    {
+      selected = (e.level == LOW);
+    }
+    if ((e.pin == SCK) && (e.level == HIGH))
+    {
+      CHECK(selected);
+      rising++;
+    }
+  }
+  CHECK_EQ(rising, 16);
+  CHECK_EQ(emu.mode[MOSI], OUTPUT);
+  CHECK_EQ(emu.level[EPD_CS], HIGH);
+  emu.record_pins = false;
+}
+
+int main(void)
+{
+  testSequences();
+  testRecorder();
+  testReset();
+  testRead();
+  return checkResult("test_pins");
+}
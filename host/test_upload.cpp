@@ -0,0 +1,261 @@
+//=============================================================================
+// Host test: the serial upload receiver puts what was sent into the panel's
+// RAM with packed runs split across frames at every point, answers a bad
+// CRC so the frame can be sent again, uses a repeated frame once, and
+// refuses more data than the window holds
+//=============================================================================
+#include <string>
+#include <vector>
+#include "driver.h"
+#include "check.h"
+
+typedef ePaperUpload<EPDPanel> Upload;
+
+static HardwareSerial port;
+static uint8_t seq = 0;
+
+//A frame as tools/epd_upload.py sends it
+static std::string frame(char type, uint8_t frame_seq, const uint8_t *payload, uint16_t length)
+{
+  uint8_t header[4] = { (uint8_t)type, frame_seq, (uint8_t)length, (uint8_t)(length >> 8) };
+  uint16_t check = crc16(crc16(0xffff, header, sizeof(header)), payload, length);
+  std::string out;
+  out += (char)UPLOAD_SYNC1;
+  out += (char)UPLOAD_SYNC2;
+  out.append((const char *)header, sizeof(header));
+  out.append((const char *)payload, length);
+  out += (char)(uint8_t)check;
+  out += (char)(uint8_t)(check >> 8);
+  return out;
+}
+
+//Hand bytes to the receiver, the status of its answer or -1 if there was
+//none. The answer must carry answer_seq and a good CRC.
+static int deliver(Upload &upload, const std::string &bytes, uint8_t answer_seq)
+{
+  port.in += bytes;
+  port.out.clear();
+  upload.service(port);
+  CHECK(port.in.empty());
+  if (port.out.empty())
+  {
+    return -1;
+  }
+  const uint8_t *a = (const uint8_t *)port.out.data();
+  CHECK_EQ(port.out.size(), 9);
+  CHECK_EQ(a[0], UPLOAD_SYNC1);
+  CHECK_EQ(a[1], UPLOAD_SYNC2);
+  CHECK_EQ(a[2], 'A');
+  CHECK_EQ(a[3], answer_seq);
+  CHECK_EQ(a[4] | (a[5] << 8), 1);
+  CHECK_EQ(crc16(0xffff, a + 2, 5), a[7] | (a[8] << 8));
+  return a[6];
+}
+
+static int send(Upload &upload, char type, const uint8_t *payload = 0, uint16_t length = 0)
+{
+  seq++;
+  return deliver(upload, frame(type, seq, payload, length), seq);
+}
+
+static int begin(Upload &upload, uint8_t flags, const EPD_Window &w)
+{
+  uint8_t b[7] = { flags, w.xb1, w.xb2, (uint8_t)w.y1, (uint8_t)(w.y1 >> 8),
+                   (uint8_t)w.y2, (uint8_t)(w.y2 >> 8) };
+  return send(upload, 'B', b, sizeof(b));
+}
+
+//Both planes of the window, BW then yellow, as the panel should end up
+//with them
+static std::vector<uint8_t> makePlanes(const EPD_Window &w)
+{
+  std::vector<uint8_t> planes(2 * windowBytes(w));
+  for (size_t i = 0; i < planes.size(); i++)
+  {
+    planes[i] = rand();
+  }
+  return planes;
+}
+
+//Records of every length a fill or literal can have, with a fill across
+//the end of the BW plane. planes is made into what they unpack to.
+static std::vector<uint8_t> packRuns(std::vector<uint8_t> &planes, uint16_t plane_bytes)
+{
+  std::vector<uint8_t> out;
+  size_t i = 0;
+  uint8_t fill = 2;
+  uint8_t literal = 1;
+  while (i < planes.size())
+  {
+    size_t left = planes.size() - i;
+    size_t n;
+    if ((i < plane_bytes) && (plane_bytes < i + 129) && (2 <= left))
+    {
+      //the rest of the BW plane and one byte of yellow
+      n = (plane_bytes + 1 - i < 2) ? 2 : (plane_bytes + 1 - i);
+    }
+    else if ((planes[i] & 1) && (2 <= left))
+    {
+      n = (fill < left) ? fill : left;
+      fill = (fill == 129) ? 2 : (fill + 1);
+    }
+    else
+    {
+      n = (literal < left) ? literal : left;
+      literal = (literal == 128) ? 1 : (literal + 1);
+      out.push_back(n - 1);
+      out.insert(out.end(), planes.begin() + i, planes.begin() + i + n);
+      i += n;
+      continue;
+    }
+    out.push_back(0x80 + n - 2);
+    out.push_back(planes[i]);
+    memset(&planes[i], planes[i], n);
+    i += n;
+  }
+  return out;
+}
+
+//Panel RAM holds planes in the window
+static bool panelHolds(const EmuController &panel, const EPD_Window &w,
+                       const std::vector<uint8_t> &planes)
+{
+  uint16_t width = w.xb2 - w.xb1 + 1;
+  uint16_t n = windowBytes(w);
+  for (uint8_t p = 0; p < 2; p++)
+  {
+    for (uint16_t i = 0; i < n; i++)
+    {
+      if (panel.ram[p][w.y1 + i / width][w.xb1 + i % width] != planes[p * n + i])
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static EPD_Window fullWindow(void)
+{
+  EPD_Window w = { 0, EPD_ROW_BYTES - 1, 0, EPD_VRES - 1 };
+  return w;
+}
+
+//Packed uploads in frames of every size up to the largest: runs are split
+//after their first byte, between a fill's count and value and through
+//literals, and carry on into the yellow plane
+static void testSplitRuns(EmuController &panel)
+{
+  Upload upload;
+  EPD_Window windows[2] = { fullWindow(), { 3, 9, 40, 170 } };
+  srand(20);
+  for (uint8_t k = 0; k < 2; k++)
+  {
+    const EPD_Window &w = windows[k];
+    uint8_t flags = UPLOAD_PACKED | (k ? UPLOAD_PARTIAL : 0);
+    std::vector<uint8_t> planes = makePlanes(w);
+    std::vector<uint8_t> packed = packRuns(planes, windowBytes(w));
+    for (uint16_t size = 1; size <= EPD_UPLOAD_PAYLOAD; size += (size < 16) ? 1 : 37)
+    {
+      memset(panel.ram, 0x55, sizeof(panel.ram));
+      uint32_t refreshes = panel.stats.refreshes + panel.stats.partial_refreshes;
+      CHECK_EQ(begin(upload, flags, w), UPLOAD_OK);
+      for (size_t at = 0; at < packed.size(); at += size)
+      {
+        uint16_t n = (packed.size() - at < size) ? (packed.size() - at) : size;
+        CHECK_EQ(send(upload, 'D', &packed[at], n), UPLOAD_OK);
+      }
+      CHECK_EQ(send(upload, 'E'), UPLOAD_OK);
+      EPDAsync::waitIdle();
+      upload.service(port);
+      CHECK(panelHolds(panel, w, planes));
+      CHECK_EQ(panel.stats.refreshes + panel.stats.partial_refreshes, refreshes + 1);
+    }
+  }
+}
+
+//A damaged frame is answered UPLOAD_CRC and changes nothing, the same
+//frame sent again is used; a frame sent twice is used once
+static void testBadCRCAndRepeats(EmuController &panel)
+{
+  Upload upload;
+  EPD_Window w = fullWindow();
+  std::vector<uint8_t> planes = makePlanes(w);
+  memset(panel.ram, 0x55, sizeof(panel.ram));
+  CHECK_EQ(begin(upload, 0, w), UPLOAD_OK);
+  for (size_t at = 0; at < planes.size(); at += EPD_UPLOAD_PAYLOAD)
+  {
+    uint16_t n = (planes.size() - at < EPD_UPLOAD_PAYLOAD) ? (planes.size() - at) : EPD_UPLOAD_PAYLOAD;
+    seq++;
+    std::string good = frame('D', seq, &planes[at], n);
+    if ((at / EPD_UPLOAD_PAYLOAD) % 3 == 0)
+    {
+      //a bit flipped in the payload or the CRC
+      std::string bad = good;
+      size_t bit = (at * 7) % ((bad.size() - 6) * 8);
+      bad[6 + bit / 8] ^= (char)(1 << (bit & 7));
+      CHECK_EQ(deliver(upload, bad, seq), UPLOAD_CRC);
+      //or in seq, the answer carries the seq that arrived
+      bad = good;
+      bad[3] ^= 0x10;
+      CHECK_EQ(deliver(upload, bad, seq ^ 0x10), UPLOAD_CRC);
+    }
+    CHECK_EQ(deliver(upload, good, seq), UPLOAD_OK);
+    if ((at / EPD_UPLOAD_PAYLOAD) % 4 == 1)
+    {
+      //its answer went missing
+      CHECK_EQ(deliver(upload, good, seq), UPLOAD_OK);
+    }
+  }
+  CHECK_EQ(send(upload, 'E'), UPLOAD_OK);
+  EPDAsync::waitIdle();
+  CHECK(panelHolds(panel, w, planes));
+
+  //a seq skipped is refused without ending the upload
+  CHECK_EQ(begin(upload, 0, w), UPLOAD_OK);
+  seq++;
+  CHECK_EQ(send(upload, 'D', &planes[0], 8), UPLOAD_SEQUENCE);
+  seq -= 2;
+  CHECK_EQ(send(upload, 'D', &planes[0], 8), UPLOAD_OK);
+  CHECK_EQ(send(upload, 'E'), UPLOAD_SHORT);
+}
+
+//More than the window holds is refused, raw or packed, and the upload is
+//over: the next frame needs a 'B'
+static void testOverflow(void)
+{
+  Upload upload;
+  EPD_Window w = { 2, 4, 10, 19 };
+  uint16_t n = windowBytes(w);
+  std::vector<uint8_t> raw(2 * n + 1, 0x3c);
+  CHECK_EQ(begin(upload, UPLOAD_PARTIAL, w), UPLOAD_OK);
+  CHECK_EQ(send(upload, 'D', &raw[0], 2 * n), UPLOAD_OK);
+  CHECK_EQ(send(upload, 'D', &raw[0], 1), UPLOAD_OVERFLOW);
+  CHECK_EQ(send(upload, 'E'), UPLOAD_SEQUENCE);
+
+  //a fill run one byte too long, its count and value in separate frames
+  uint8_t count = 0x80 + (2 * n + 1) - 2;
+  uint8_t value = 0x3c;
+  CHECK(2 * n + 1 <= 129);
+  CHECK_EQ(begin(upload, UPLOAD_PARTIAL | UPLOAD_PACKED, w), UPLOAD_OK);
+  CHECK_EQ(send(upload, 'D', &count, 1), UPLOAD_OK);
+  CHECK_EQ(send(upload, 'D', &value, 1), UPLOAD_OVERFLOW);
+  CHECK_EQ(send(upload, 'E'), UPLOAD_SEQUENCE);
+
+  //exactly full is fine
+  CHECK_EQ(begin(upload, UPLOAD_PARTIAL, w), UPLOAD_OK);
+  CHECK_EQ(send(upload, 'D', &raw[0], 2 * n), UPLOAD_OK);
+  CHECK_EQ(send(upload, 'E'), UPLOAD_OK);
+  EPDAsync::waitIdle();
+  upload.service(port);
+}
+
+int main(void)
+{
+  EmuController &panel = hostPanel();
+  testSplitRuns(panel);
+  testBadCRCAndRepeats(panel);
+  testOverflow();
+  CHECK_EQ(panel.errors, 0);
+  return checkResult("test_upload");
+}
@@ -0,0 +1,502 @@
+#!/usr/bin/env python3
+#==============================================================================
+# Send an image to the sketch over serial, see Upload_for_CFAP104212E00213.h
+# for the frame format. Build the sketch with SERIAL_UPLOAD set to 1.
+#
+#   python3 epd_upload.py --port /dev/ttyACM0 price.bmp
+#   python3 epd_upload.py --port /dev/ttyACM0 --window 24,96,79,111 price.bmp
+#   python3 epd_upload.py --loopback --loss 0.002 price.bmp
+#
+# The image is a 104 x 212 24 bit BMP (or --planes, a file holding the BW
+# plane and then the yellow plane, 1 = black and 1 = yellow). Each pixel
+# becomes whichever of white, black and yellow is nearest. --window sends
+# and refreshes only pixels x1,y1 - x2,y2 of it as a partial update; x is
+# widened to whole bytes.
+#
+# The planes are packed (see pack_images.py) when that makes them smaller,
+# unless --raw is given.
+#
+# --loopback runs the frames through a model of the sketch's receiver
+# instead of a port, checks that the planes it ends up with are the ones
+# sent, and prints the frame count and the time the bytes take at --baud.
+# --loss drops and damages bytes in both directions, to exercise the
+# retries. pyserial is only needed for --port.
+#==============================================================================
+import argparse
+import os
+import random
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from pack_images import pack  # noqa: E402
+
+HRES = 104
+VRES = 212
+ROW_BYTES = (HRES + 7) // 8
+
+SYNC = b'\xe5\x9d'
+PAYLOAD = 128
+BAUD = 1000000
+
+PARTIAL = 0x01
+PACKED = 0x02
+
+STATUS = ['ok', 'crc', 'frame', 'sequence', 'overflow', 'short', 'window',
+          'busy']
+OK, CRC, BUSY = 0, 1, 7
+
+# Per frame answer wait, and how long 'B' is retried while the panel is
+# still refreshing
+ANSWER_TIMEOUT = 0.5
+BUSY_TIMEOUT = 30.0
+RETRIES = 8
+
+
+def crc16(data, crc=0xffff):
+    # CRC-16/CCITT, as crc16() in Cache_for_CFAP104212E00213.h
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+            crc &= 0xffff
+    return crc
+
+
+def frame(kind, seq, payload=b''):
+    body = struct.pack('<BBH', ord(kind), seq & 0xff, len(payload)) + payload
+    return SYNC + body + struct.pack('<H', crc16(body))
+
+
+class FrameReader:
+    # Pulls frames out of a byte stream, skipping anything between them
+
+    def __init__(self):
+        self.buffer = bytearray()
+
+    def feed(self, data):
+        self.buffer.extend(data)
+        frames = []
+        while True:
+            at = self.buffer.find(SYNC)
+            if at < 0:
+                del self.buffer[:-1]
+                return frames
+            del self.buffer[:at]
+            if len(self.buffer) < 6:
+                return frames
+            kind, seq, length = struct.unpack_from('<BBH', self.buffer, 2)
+            if length > PAYLOAD:
+                del self.buffer[:1]
+                continue
+            if len(self.buffer) < 8 + length:
+                return frames
+            body = bytes(self.buffer[2:6 + length])
+            crc, = struct.unpack_from('<H', self.buffer, 6 + length)
+            if crc == crc16(body):
+                frames.append((chr(kind), seq, body[4:]))
+                del self.buffer[:8 + length]
+            else:
+                del self.buffer[:1]
+
+
+#==============================================================================
+# Image to planes
+
+def read_bmp(path):
+    data = open(path, 'rb').read()
+    if data[:2] != b'BM':
+        sys.exit('%s is not a BMP' % path)
+    offset, = struct.unpack_from('<I', data, 10)
+    width, height, planes, bits, compression = struct.unpack_from(
+        '<iiHHI', data, 18)
+    if bits != 24 or compression != 0:
+        sys.exit('%s: only uncompressed 24 bit BMPs' % path)
+    top_down = height < 0
+    height = abs(height)
+    line = (width * 3 + 3) & ~3
+    pixels = []
+    for y in range(height):
+        row = y if top_down else height - 1 - y
+        at = offset + row * line
+        # stored blue, green, red
+        pixels.append([(data[at + x * 3 + 2], data[at + x * 3 + 1],
+                        data[at + x * 3]) for x in range(width)])
+    return width, height, pixels
+
+
+def nearest(rgb):
+    # 0 white, 1 black, 2 yellow
+    colors = ((255, 255, 255), (0, 0, 0), (255, 255, 0))
+    distance = [sum((a - b) ** 2 for a, b in zip(rgb, c)) for c in colors]
+    return distance.index(min(distance))
+
+
+def image_planes(path):
+    width, height, pixels = read_bmp(path)
+    if (width, height) != (HRES, VRES):
+        sys.exit('%s is %dx%d, not %dx%d' % (path, width, height, HRES, VRES))
+    bw = bytearray(ROW_BYTES * VRES)
+    yellow = bytearray(ROW_BYTES * VRES)
+    for y in range(VRES):
+        for x in range(HRES):
+            color = nearest(pixels[y][x])
+            bit = 0x80 >> (x & 7)
+            if color == 1:
+                bw[y * ROW_BYTES + (x >> 3)] |= bit
+            elif color == 2:
+                yellow[y * ROW_BYTES + (x >> 3)] |= bit
+    return bytes(bw), bytes(yellow)
+
+
+def crop(plane, xb1, xb2, y1, y2):
+    return b''.join(plane[y * ROW_BYTES + xb1:y * ROW_BYTES + xb2 + 1]
+                    for y in range(y1, y2 + 1))
+
+
+#==============================================================================
+# Links
+
+class SerialLink:
+    def __init__(self, port, baud):
+        try:
+            import serial
+        except ImportError:
+            sys.exit('--port needs pyserial (pip install pyserial)')
+        self.port = serial.Serial(port, baud, timeout=0.01)
+        # opening the port resets most boards, wait out the boot loader
+        time.sleep(2.0)
+        self.port.reset_input_buffer()
+
+    def send(self, data):
+        self.port.write(data)
+
+    def receive(self):
+        return self.port.read(self.port.in_waiting or 1)
+
+
+class Receiver:
+    # The sketch's ePaperUpload, writing into planes instead of a panel. It
+    # takes bytes as they come, as the sketch does: packed runs carry on
+    # from one frame to the next and a frame with a bad CRC is answered.
+
+    def __init__(self):
+        self.state = 'sync1'
+        self.bw = bytearray(ROW_BYTES * VRES)
+        self.yellow = bytearray(ROW_BYTES * VRES)
+        self.active = False
+        self.last = None
+        self.refreshes = 0
+        self.busy_polls = 0
+
+    def feed(self, data):
+        out = b''
+        for c in data:
+            if self.receive(c):
+                seq = self.header[1]
+                out += frame('A', seq, bytes([self.handle_frame()]))
+        return out
+
+    def pause(self):
+        # no bytes for longer than EPD_UPLOAD_TIMEOUT_MS, a frame that
+        # stopped arriving is dropped
+        self.state = 'sync1'
+
+    def receive(self, c):
+        # true once a whole frame is in, whatever its CRC
+        if self.state == 'sync1':
+            if c == SYNC[0]:
+                self.state = 'sync2'
+        elif self.state == 'sync2':
+            self.state = ('header' if c == SYNC[1] else
+                          'sync2' if c == SYNC[0] else 'sync1')
+            self.header = bytearray()
+        elif self.state == 'header':
+            self.header.append(c)
+            if len(self.header) == 4:
+                self.length, = struct.unpack_from('<H', self.header, 2)
+                self.payload = bytearray()
+                self.crc = bytearray()
+                if self.length > PAYLOAD:
+                    # not a frame after all, look for the next
+                    self.state = 'sync1'
+                else:
+                    self.state = 'payload' if self.length else 'crc'
+        elif self.state == 'payload':
+            self.payload.append(c)
+            if len(self.payload) == self.length:
+                self.state = 'crc'
+        else:
+            self.crc.append(c)
+            if len(self.crc) == 2:
+                self.state = 'sync1'
+                return True
+        return False
+
+    def handle_frame(self):
+        crc, = struct.unpack('<H', self.crc)
+        if crc != crc16(self.header + self.payload):
+            return CRC
+        return self.handle(chr(self.header[0]), self.header[1],
+                           bytes(self.payload))
+
+    def handle(self, kind, seq, payload):
+        if self.last == (seq, kind):
+            # a repeat, its answer went missing
+            return OK
+        if kind == 'B':
+            status = self.begin(payload)
+        elif not self.active or seq != (self.last[0] + 1) & 0xff:
+            status = 3
+        elif kind == 'D':
+            status = self.data(payload)
+        elif kind == 'E':
+            status = self.end(payload)
+        else:
+            status = 2
+        if status == OK:
+            self.last = (seq, kind)
+        elif status != 3:
+            self.active = False
+        return status
+
+    def begin(self, payload):
+        if len(payload) != 7:
+            return 2
+        self.active = False
+        if self.busy_polls:
+            # pretend the last refresh is still running once or twice
+            self.busy_polls -= 1
+            return BUSY
+        self.flags, xb1, xb2, y1, y2 = struct.unpack('<BBBHH', payload)
+        if not self.flags & PARTIAL:
+            xb1, xb2, y1, y2 = 0, ROW_BYTES - 1, 0, VRES - 1
+        elif xb2 < xb1 or xb2 >= ROW_BYTES or y2 < y1 or y2 >= VRES:
+            return 6
+        self.window = (xb1, xb2, y1, y2)
+        self.written = 0
+        self.run_left = 0
+        self.need_value = False
+        self.active = True
+        return OK
+
+    def data(self, payload):
+        if not self.flags & PACKED:
+            return self.put(payload)
+        i = 0
+        while i < len(payload):
+            if self.run_left == 0:
+                c = payload[i]
+                i += 1
+                self.run_fill = c >= 0x80
+                self.run_left = c - 0x80 + 2 if self.run_fill else c + 1
+                self.need_value = self.run_fill
+                continue
+            if self.run_fill:
+                if self.need_value:
+                    self.run_value = payload[i]
+                    i += 1
+                    self.need_value = False
+                status = self.put(bytes([self.run_value]) * self.run_left)
+                self.run_left = 0
+            else:
+                n = min(len(payload) - i, self.run_left)
+                status = self.put(payload[i:i + n])
+                i += n
+                self.run_left -= n
+            if status != OK:
+                return status
+        return OK
+
+    def put(self, data):
+        # into the window of the BW plane, then of the yellow plane, as the
+        # panel's RAM takes it
+        xb1, xb2, y1, y2 = self.window
+        width = xb2 - xb1 + 1
+        n = width * (y2 - y1 + 1)
+        for b in data:
+            if self.written == 2 * n:
+                return 4
+            plane, at = divmod(self.written, n)
+            row = (y1 + at // width) * ROW_BYTES
+            (self.bw, self.yellow)[plane][row + xb1 + at % width] = b
+            self.written += 1
+        return OK
+
+    def end(self, payload):
+        if payload:
+            return 2
+        xb1, xb2, y1, y2 = self.window
+        n = (xb2 - xb1 + 1) * (y2 - y1 + 1)
+        if self.written != 2 * n or self.run_left or self.need_value:
+            return 5
+        self.active = False
+        self.refreshes += 1
+        self.busy_polls = 2
+        return OK
+
+
+class LoopbackLink:
+    # Bytes go to a Receiver, each way through a channel that loses some
+
+    def __init__(self, loss, seed):
+        self.receiver = Receiver()
+        self.loss = loss
+        self.random = random.Random(seed)
+        self.pending = b''
+        self.wire_bytes = 0
+
+    def damage(self, data):
+        out = bytearray()
+        for b in data:
+            roll = self.random.random()
+            if roll < self.loss / 2:
+                continue
+            if roll < self.loss:
+                b ^= 1 << self.random.randrange(8)
+            out.append(b)
+        return bytes(out)
+
+    def send(self, data):
+        # a frame follows an answer or ANSWER_TIMEOUT without one, both
+        # longer than the sketch's frame timeout
+        self.receiver.pause()
+        self.wire_bytes += len(data)
+        answer = self.receiver.feed(self.damage(data))
+        self.wire_bytes += len(answer)
+        self.pending += self.damage(answer)
+
+    def receive(self):
+        data, self.pending = self.pending, b''
+        return data
+
+
+#==============================================================================
+# Sender
+
+class Sender:
+    def __init__(self, link):
+        self.link = link
+        self.reader = FrameReader()
+        self.seq = random.randrange(256)
+        self.frames = 0
+        self.resends = 0
+
+    def answer(self, seq, timeout):
+        end = time.time() + timeout
+        while time.time() < end:
+            for kind, got, payload in self.reader.feed(self.link.receive()):
+                if kind == 'A' and got == seq and len(payload) == 1:
+                    return payload[0]
+            if isinstance(self.link, LoopbackLink):
+                # the loopback answers at once or never
+                return None
+        return None
+
+    def send(self, kind, payload=b''):
+        self.seq = (self.seq + 1) & 0xff
+        data = frame(kind, self.seq, payload)
+        busy_until = time.time() + BUSY_TIMEOUT
+        tries = 0
+        while True:
+            self.frames += 1
+            self.link.send(data)
+            status = self.answer(self.seq, ANSWER_TIMEOUT)
+            if status == OK:
+                return
+            if status == BUSY and time.time() < busy_until:
+                if not isinstance(self.link, LoopbackLink):
+                    time.sleep(0.05)
+                continue
+            if status is not None and status != CRC:
+                raise IOError("'%s' refused: %s" % (kind, STATUS[status]
+                              if status < len(STATUS) else status))
+            tries += 1
+            self.resends += 1
+            if RETRIES < tries:
+                raise IOError("'%s' not answered" % kind)
+
+    def upload(self, bw, yellow, window, packed):
+        xb1, xb2, y1, y2 = window
+        flags = 0 if window == (0, ROW_BYTES - 1, 0, VRES - 1) else PARTIAL
+        data = crop(bw, *window) + crop(yellow, *window)
+        if packed:
+            # each plane on its own, so no run crosses from one to the other
+            n = len(data) // 2
+            packed_data = pack(data[:n]) + pack(data[n:])
+            if len(packed_data) < len(data):
+                data = packed_data
+                flags |= PACKED
+        self.send('B', struct.pack('<BBBHH', flags, xb1, xb2, y1, y2))
+        for at in range(0, len(data), PAYLOAD):
+            self.send('D', data[at:at + PAYLOAD])
+        self.send('E')
+        return flags, len(data)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Send an image to the sketch over serial')
+    parser.add_argument('image', help='104 x 212 24 bit BMP')
+    parser.add_argument('--planes', action='store_true',
+                        help='image is the raw BW and yellow planes')
+    parser.add_argument('--port', help='serial port of the board')
+    parser.add_argument('--baud', type=int, default=BAUD)
+    parser.add_argument('--window', help='x1,y1,x2,y2 to update, inclusive')
+    parser.add_argument('--raw', action='store_true', help='do not pack')
+    parser.add_argument('--loopback', action='store_true',
+                        help='send to a model of the sketch instead')
+    parser.add_argument('--loss', type=float, default=0.0,
+                        help='loopback: fraction of bytes lost or damaged')
+    parser.add_argument('--seed', type=int, default=1)
+    args = parser.parse_args()
+
+    if args.planes:
+        data = open(args.image, 'rb').read()
+        n = ROW_BYTES * VRES
+        if len(data) != 2 * n:
+            sys.exit('%s is not %d bytes' % (args.image, 2 * n))
+        bw, yellow = data[:n], data[n:]
+    else:
+        bw, yellow = image_planes(args.image)
+
+    window = (0, ROW_BYTES - 1, 0, VRES - 1)
+    if args.window:
+        x1, y1, x2, y2 = (int(v) for v in args.window.split(','))
+        window = (x1 >> 3, x2 >> 3, y1, y2)
+
+    if args.loopback:
+        random.seed(args.seed)
+        link = LoopbackLink(args.loss, args.seed)
+    elif args.port:
+        link = SerialLink(args.port, args.baud)
+    else:
+        sys.exit('give --port or --loopback')
+
+    sender = Sender(link)
+    start = time.time()
+    flags, sent = sender.upload(bw, yellow, window, not args.raw)
+    elapsed = time.time() - start
+
+    print('%s%s, %d bytes of plane data in %d frames (%d sent again)' %
+          ('partial' if flags & PARTIAL else 'full',
+           ', packed' if flags & PACKED else '', sent, sender.frames,
+           sender.resends))
+    if args.loopback:
+        receiver = link.receiver
+        xb1, xb2, y1, y2 = window
+        for name, sent_plane, got_plane in (('BW', bw, receiver.bw),
+                                            ('yellow', yellow,
+                                             receiver.yellow)):
+            if crop(sent_plane, *window) != crop(bytes(got_plane), *window):
+                sys.exit('loopback: %s plane differs' % name)
+        print('loopback: planes match, %d bytes on the wire, %.1f ms at %d '
+              'baud' % (link.wire_bytes, link.wire_bytes * 10000.0 /
+                        args.baud, args.baud))
+    else:
+        print('refresh started after %.0f ms' % (elapsed * 1000))
+
+
+if __name__ == '__main__':
+    main()
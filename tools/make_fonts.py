@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+#==============================================================================
+# Write Fonts_for_CFAP104212E00213.h, the PROGMEM fonts read by
+# Text_for_CFAP104212E00213.h.
+#
+#   python3 make_fonts.py > ../CFAP104212E00213/Fonts_for_CFAP104212E00213.h
+#
+# The glyphs come from the classic 5x7 (plus descender) LCD font below, one
+# byte per column, bit 0 at the top. Each glyph is trimmed to its inked
+# columns and advances one column past them, which makes the font
+# proportional. Digits keep all 5 columns so numbers do not shift about as
+# they change (tabular figures).
+#
+# A font is a glyph index table and the glyph bitmaps:
+#   EPD_Glyph {offset, width, advance} per character, first to last
+#   bitmap rows top to bottom, (width + 7) / 8 bytes each, MSB on the left
+#==============================================================================
+import sys
+
+FIRST = 0x20
+COLUMNS = [
+    0x00, 0x00, 0x00, 0x00, 0x00,  # space
+    0x00, 0x00, 0x5F, 0x00, 0x00,  # !
+    0x00, 0x07, 0x00, 0x07, 0x00,  # "
+    0x14, 0x7F, 0x14, 0x7F, 0x14,  # #
+    0x24, 0x2A, 0x7F, 0x2A, 0x12,  # $
+    0x23, 0x13, 0x08, 0x64, 0x62,  # %
+    0x36, 0x49, 0x56, 0x20, 0x50,  # &
+    0x00, 0x08, 0x07, 0x03, 0x00,  # '
+    0x00, 0x1C, 0x22, 0x41, 0x00,  # (
+    0x00, 0x41, 0x22, 0x1C, 0x00,  # )
+    0x2A, 0x1C, 0x7F, 0x1C, 0x2A,  # *
+    0x08, 0x08, 0x3E, 0x08, 0x08,  # +
+    0x00, 0x80, 0x70, 0x30, 0x00,  # ,
+    0x08, 0x08, 0x08, 0x08, 0x08,  # -
+    0x00, 0x00, 0x60, 0x60, 0x00,  # .
+    0x20, 0x10, 0x08, 0x04, 0x02,  # /
+    0x3E, 0x51, 0x49, 0x45, 0x3E,  # 0
+    0x00, 0x42, 0x7F, 0x40, 0x00,  # 1
+    0x72, 0x49, 0x49, 0x49, 0x46,  # 2
+    0x21, 0x41, 0x49, 0x4D, 0x33,  # 3
+    0x18, 0x14, 0x12, 0x7F, 0x10,  # 4
+    0x27, 0x45, 0x45, 0x45, 0x39,  # 5
+    0x3C, 0x4A, 0x49, 0x49, 0x31,  # 6
+    0x41, 0x21, 0x11, 0x09, 0x07,  # 7
+    0x36, 0x49, 0x49, 0x49, 0x36,  # 8
+    0x46, 0x49, 0x49, 0x29, 0x1E,  # 9
+    0x00, 0x00, 0x14, 0x00, 0x00,  # :
+    0x00, 0x40, 0x34, 0x00, 0x00,  # ;
+    0x00, 0x08, 0x14, 0x22, 0x41,  # <
+    0x14, 0x14, 0x14, 0x14, 0x14,  # =
+    0x00, 0x41, 0x22, 0x14, 0x08,  # >
+    0x02, 0x01, 0x59, 0x09, 0x06,  # ?
+    0x3E, 0x41, 0x5D, 0x59, 0x4E,  # @
+    0x7C, 0x12, 0x11, 0x12, 0x7C,  # A
+    0x7F, 0x49, 0x49, 0x49, 0x36,  # B
+    0x3E, 0x41, 0x41, 0x41, 0x22,  # C
+    0x7F, 0x41, 0x41, 0x41, 0x3E,  # D
+    0x7F, 0x49, 0x49, 0x49, 0x41,  # E
+    0x7F, 0x09, 0x09, 0x09, 0x01,  # F
+    0x3E, 0x41, 0x41, 0x51, 0x73,  # G
+    0x7F, 0x08, 0x08, 0x08, 0x7F,  # H
+    0x00, 0x41, 0x7F, 0x41, 0x00,  # I
+    0x20, 0x40, 0x41, 0x3F, 0x01,  # J
+    0x7F, 0x08, 0x14, 0x22, 0x41,  # K
+    0x7F, 0x40, 0x40, 0x40, 0x40,  # L
+    0x7F, 0x02, 0x1C, 0x02, 0x7F,  # M
+    0x7F, 0x04, 0x08, 0x10, 0x7F,  # N
+    0x3E, 0x41, 0x41, 0x41, 0x3E,  # O
+    0x7F, 0x09, 0x09, 0x09, 0x06,  # P
+    0x3E, 0x41, 0x51, 0x21, 0x5E,  # Q
+    0x7F, 0x09, 0x19, 0x29, 0x46,  # R
+    0x26, 0x49, 0x49, 0x49, 0x32,  # S
+    0x03, 0x01, 0x7F, 0x01, 0x03,  # T
+    0x3F, 0x40, 0x40, 0x40, 0x3F,  # U
+    0x1F, 0x20, 0x40, 0x20, 0x1F,  # V
+    0x3F, 0x40, 0x38, 0x40, 0x3F,  # W
+    0x63, 0x14, 0x08, 0x14, 0x63,  # X
+    0x03, 0x04, 0x78, 0x04, 0x03,  # Y
+    0x61, 0x59, 0x49, 0x4D, 0x43,  # Z
+    0x00, 0x7F, 0x41, 0x41, 0x41,  # [
+    0x02, 0x04, 0x08, 0x10, 0x20,  # backslash
+    0x00, 0x41, 0x41, 0x41, 0x7F,  # ]
+    0x04, 0x02, 0x01, 0x02, 0x04,  # ^
+    0x40, 0x40, 0x40, 0x40, 0x40,  # _
+    0x00, 0x03, 0x07, 0x08, 0x00,  # `
+    0x20, 0x54, 0x54, 0x78, 0x40,  # a
+    0x7F, 0x28, 0x44, 0x44, 0x38,  # b
+    0x38, 0x44, 0x44, 0x44, 0x28,  # c
+    0x38, 0x44, 0x44, 0x28, 0x7F,  # d
+    0x38, 0x54, 0x54, 0x54, 0x18,  # e
+    0x00, 0x08, 0x7E, 0x09, 0x02,  # f
+    0x18, 0xA4, 0xA4, 0x9C, 0x78,  # g
+    0x7F, 0x08, 0x04, 0x04, 0x78,  # h
+    0x00, 0x44, 0x7D, 0x40, 0x00,  # i
+    0x20, 0x40, 0x40, 0x3D, 0x00,  # j
+    0x7F, 0x10, 0x28, 0x44, 0x00,  # k
+    0x00, 0x41, 0x7F, 0x40, 0x00,  # l
+    0x7C, 0x04, 0x78, 0x04, 0x78,  # m
+    0x7C, 0x08, 0x04, 0x04, 0x78,  # n
+    0x38, 0x44, 0x44, 0x44, 0x38,  # o
+    0xFC, 0x18, 0x24, 0x24, 0x18,  # p
+    0x18, 0x24, 0x24, 0x18, 0xFC,  # q
+    0x7C, 0x08, 0x04, 0x04, 0x08,  # r
+    0x48, 0x54, 0x54, 0x54, 0x24,  # s
+    0x04, 0x04, 0x3F, 0x44, 0x24,  # t
+    0x3C, 0x40, 0x40, 0x20, 0x7C,  # u
+    0x1C, 0x20, 0x40, 0x20, 0x1C,  # v
+    0x3C, 0x40, 0x30, 0x40, 0x3C,  # w
+    0x44, 0x28, 0x10, 0x28, 0x44,  # x
+    0x4C, 0x90, 0x90, 0x90, 0x7C,  # y
+    0x44, 0x64, 0x54, 0x4C, 0x44,  # z
+    0x00, 0x08, 0x36, 0x41, 0x00,  # {
+    0x00, 0x00, 0x77, 0x00, 0x00,  # |
+    0x00, 0x41, 0x36, 0x08, 0x00,  # }
+    0x02, 0x01, 0x02, 0x04, 0x02,  # ~
+]
+LAST = FIRST + len(COLUMNS) // 5 - 1
+HEIGHT = 8
+#Widest glyph Text_for_CFAP104212E00213.h handles
+MAX_WIDTH = 16
+
+
+def glyph_columns(c):
+    cols = COLUMNS[(c - FIRST) * 5:(c - FIRST) * 5 + 5]
+    if chr(c).isdigit():
+        return cols
+    inked = [i for i, v in enumerate(cols) if v]
+    if not inked:
+        return []
+    return cols[inked[0]:inked[-1] + 1]
+
+
+def make_font(name, first, last, scale, space):
+    glyphs = []
+    bitmap = bytearray()
+    for c in range(first, last + 1):
+        cols = [v for v in glyph_columns(c) for _ in range(scale)]
+        width = len(cols)
+        assert width <= MAX_WIDTH
+        advance = width + scale if width else space
+        glyphs.append((len(bitmap), width, advance, c))
+        row_bytes = (width + 7) // 8
+        for y in range(HEIGHT * scale):
+            bits = 0
+            for x, v in enumerate(cols):
+                if (v >> (y // scale)) & 1:
+                    bits |= 0x80 << (8 * (row_bytes - 1)) >> x
+            bitmap.extend(bits.to_bytes(row_bytes, 'big') if row_bytes else b'')
+    out = []
+    out.append('//%d bytes of glyphs, %d of index' % (len(bitmap), 4 * len(glyphs)))
+    out.append('const uint8_t %s_Bitmap[%d] PROGMEM =' % (name, len(bitmap)))
+    rows = [','.join('0x%02X' % b for b in bitmap[j:j + 13])
+            for j in range(0, len(bitmap), 13)]
+    out.append('{ ' + ',\n'.join(rows) + ' };')
+    out.append('const EPD_Glyph %s_Glyphs[%d] PROGMEM =' % (name, len(glyphs)))
+    out.append('{')
+    for offset, width, advance, c in glyphs:
+        label = 'backslash' if chr(c) == '\\' else ("'%s'" % chr(c))
+        out.append('  { %4d, %2d, %2d }, //%s' % (offset, width, advance, label))
+    out.append('};')
+    out.append('const EPD_Font %s = { %s_Bitmap, %s_Glyphs, 0x%02X, 0x%02X, %d };'
+               % (name, name, name, first, last, HEIGHT * scale))
+    return '\n'.join(out)
+
+
+def main():
+    print('#ifndef __FONTS_FOR_CFAP104212E00213_H__')
+    print('#define __FONTS_FOR_CFAP104212E00213_H__')
+    print('//' + '=' * 77)
+    print('// Fonts for Text_for_CFAP104212E00213.h, written by tools/make_fonts.py')
+    print('//')
+    print('//   Font_Small   8 rows, all of printable ASCII')
+    print('//   Font_Large  16 rows, space to \':\' (digits, + - . / % :), twice size')
+    print('//' + '=' * 77)
+    print()
+    print(make_font('Font_Small', FIRST, LAST, 1, 3))
+    print()
+    print(make_font('Font_Large', FIRST, ord(':'), 2, 6))
+    print()
+    print('//' + '=' * 77)
+    print('#endif')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+#==============================================================================
+# Pack the image planes of an Images_for_*.h header (as written by
+# bmp_to_epaper) into the PROGMEM format read by streamPacked() and
+# ePaperUnpacker in Packed_for_CFAP104212E00213.h.
+#
+#   python3 pack_images.py Images_for_CFAP104212E00213.h > Packed.h
+#
+# Each "const uint8_t NAME[N] PROGMEM = { ... };" array becomes NAME_Packed
+# (a trailing _1BPP is dropped) plus NAME_Packed_SIZE. Everything else in the
+# header (include guard, comments, #defines) is copied through.
+#
+# Format, a sequence of runs, decoded until the plane's length is reached:
+#   0x00-0x7F  n: the next n + 1 bytes are copied (1-128 bytes)
+#   0x80-0xFF  n: the next byte is repeated n - 0x80 + 2 times (2-129 bytes)
+#==============================================================================
+import re
+import sys
+
+MAX_LITERAL = 128
+MIN_FILL = 2
+MAX_FILL = 129
+
+
+def pack(data):
+    out = bytearray()
+    literal = bytearray()
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del literal[:MAX_LITERAL]
+
+    i = 0
+    while i < len(data):
+        run = 1
+        while (i + run < len(data) and data[i + run] == data[i] and
+               run < MAX_FILL):
+            run += 1
+        # a pair is only worth a fill when it does not split a literal
+        if run >= 3 or (run == MIN_FILL and not literal):
+            flush()
+            out.append(0x80 + run - MIN_FILL)
+            out.append(data[i])
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush()
+    return bytes(out)
+
+
+def unpack(packed, n):
+    out = bytearray()
+    i = 0
+    while len(out) < n:
+        c = packed[i]
+        i += 1
+        if c < 0x80:
+            out.extend(packed[i:i + c + 1])
+            i += c + 1
+        else:
+            out.extend(bytes([packed[i]]) * (c - 0x80 + MIN_FILL))
+            i += 1
+    return bytes(out[:n])
+
+
+ARRAY = re.compile(
+    r'const\s+uint8_t\s+(\w+)\s*\[\s*(\d*)\s*\]\s*PROGMEM\s*=\s*\{([^}]*)\}\s*;',
+    re.S)
+
+
+def emit(name, data):
+    packed = pack(data)
+    assert unpack(packed, len(data)) == data
+    base = name[:-5] if name.endswith('_1BPP') else name
+    lines = ['//%d bytes packed from %d' % (len(packed), len(data)),
+             '#define %s_Packed_SIZE (%d)' % (base, len(data)),
+             'const uint8_t %s_Packed[%d] PROGMEM =' % (base, len(packed))]
+    rows = [','.join('0x%02X' % b for b in packed[j:j + 13])
+            for j in range(0, len(packed), 13)]
+    lines.append('{ ' + ',\n'.join(rows) + ' };')
+    return '\n'.join(lines), len(packed), len(data)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit('usage: pack_images.py Images_for_<panel>.h')
+    text = open(sys.argv[1]).read()
+    totals = [0, 0]
+
+    def replace(match):
+        data = bytes(int(v, 0) for v in match.group(3).replace(',', ' ').split())
+        if match.group(2) and int(match.group(2)) != len(data):
+            sys.exit('%s: %s values for [%s]' %
+                     (match.group(1), len(data), match.group(2)))
+        code, packed, raw = emit(match.group(1), data)
+        totals[0] += packed
+        totals[1] += raw
+        return code
+
+    sys.stdout.write(ARRAY.sub(replace, text))
+    sys.stderr.write('%d bytes packed from %d\n' % (totals[0], totals[1]))
+
+
+if __name__ == '__main__':
+    main()